@@ -0,0 +1,172 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// ӵ 2D  (Project2, Project3 )
+// std::vector<std::vector<T>> Ͽ ึ  Ҵ ʰ ü   Ҵ
+//
+//  -  ۰    ALIGNMENT(64Ʈ, ĳ ) 迡 
+//  - stride =   ϴ   (width ̻,   е )
+//  - buffer[y]  ͸ ֹǷ  [y][x]  ڵ带 ״   
+//  - View() Ϻ    Ű 並   
+
+/**
+ * @brief Buffer2D Ϻ (Ǵ ü) Ű . ޸𸮸  .
+ *         ۰ Ҵǰų ҸǸ  ̻   .
+ */
+template <typename T>
+class View2D {
+public:
+	View2D() = default;
+	View2D(T* data, int width, int height, size_t stride)
+		: data(data), width(width), height(height), stride(stride) {}
+
+	// View2D<T> View2D<const T> ȯ
+	template <typename U, typename = typename std::enable_if<std::is_same<const U, T>::value>::type>
+	View2D(const View2D<U>& other)
+		: data(other.Data()), width(other.Width()), height(other.Height()), stride(other.Stride()) {}
+
+	int Width() const { return width; }
+	int Height() const { return height; }
+	size_t Stride() const { return stride; }
+	bool Empty() const { return width == 0 || height == 0; }
+	T* Data() const { return data; }
+
+	T* Row(int y) const {
+		assert(y >= 0 && y < height);
+		return data + static_cast<size_t>(y) * stride;
+	}
+	T* operator[](int y) const { return Row(y); }
+
+	/**
+	 * @brief (x, y) ϴ w x h  並 ϴ ( ).
+	 */
+	View2D View(int x, int y, int w, int h) const {
+		assert(x >= 0 && y >= 0 && w >= 0 && h >= 0 && x + w <= width && y + h <= height);
+		return View2D(data + static_cast<size_t>(y) * stride + x, w, h, stride);
+	}
+
+private:
+	T* data = nullptr;
+	int width = 0;
+	int height = 0;
+	size_t stride = 0;
+};
+
+/**
+ * @brief ĵ   Ҵ  2D .
+ *        Create() ũ⸦ ٲ   뷮 ϸ Ҵ Ƿ
+ *         ũ ̹ ݺ ó  Ҵ Ͼ .
+ *        T int, double, float, uint8_t  ܼ ŸԸ .
+ */
+template <typename T>
+class Buffer2D {
+	static_assert(std::is_trivially_copyable<T>::value, "Buffer2D<T>: T must be trivially copyable");
+
+public:
+	static const size_t ALIGNMENT = 64;
+
+	Buffer2D() = default;
+	Buffer2D(int width, int height) { Create(width, height); }
+	Buffer2D(int width, int height, const T& value) { Create(width, height); Fill(value); }
+	~Buffer2D() { delete[] storage; }
+
+	Buffer2D(const Buffer2D& other) { CopyFrom(other); }
+	Buffer2D& operator=(const Buffer2D& other) {
+		if (this != &other) CopyFrom(other);
+		return *this;
+	}
+	Buffer2D(Buffer2D&& other) noexcept { Swap(other); }
+	Buffer2D& operator=(Buffer2D&& other) noexcept {
+		Swap(other);
+		return *this;
+	}
+
+	/**
+	 * @brief ũ⸦ մϴ.    ʽϴ (ʱȭ  ).
+	 *        ʿ ũⰡ  뷮 ̸  ޸𸮸 ״ մϴ.
+	 */
+	void Create(int w, int h) {
+		assert(w >= 0 && h >= 0);
+		size_t newStride = AlignedStride(w);
+		size_t bytes = newStride * h * sizeof(T);
+		if (bytes > capacity) {
+			delete[] storage;
+			storage = nullptr;
+			data = nullptr;
+			capacity = 0;
+			//   ALIGNMENTŭ  Ҵϰ  ּҸ ø
+			storage = new unsigned char[bytes + ALIGNMENT];
+			uintptr_t address = reinterpret_cast<uintptr_t>(storage);
+			data = reinterpret_cast<T*>((address + ALIGNMENT - 1) & ~static_cast<uintptr_t>(ALIGNMENT - 1));
+			capacity = bytes;
+		}
+		width = w;
+		height = h;
+		stride = newStride;
+	}
+
+	// е   Ҹ value ä
+	void Fill(const T& value) {
+		std::fill(data, data + stride * height, value);
+	}
+
+	int Width() const { return width; }
+	int Height() const { return height; }
+	size_t Stride() const { return stride; }
+	bool Empty() const { return width == 0 || height == 0; }
+	T* Data() { return data; }
+	const T* Data() const { return data; }
+
+	T* Row(int y) {
+		assert(y >= 0 && y < height);
+		return data + static_cast<size_t>(y) * stride;
+	}
+	const T* Row(int y) const {
+		assert(y >= 0 && y < height);
+		return data + static_cast<size_t>(y) * stride;
+	}
+	T* operator[](int y) { return Row(y); }
+	const T* operator[](int y) const { return Row(y); }
+
+	View2D<T> View() { return View2D<T>(data, width, height, stride); }
+	View2D<const T> View() const { return View2D<const T>(data, width, height, stride); }
+	View2D<T> View(int x, int y, int w, int h) { return View().View(x, y, w, h); }
+	View2D<const T> View(int x, int y, int w, int h) const { return View().View(x, y, w, h); }
+
+	operator View2D<T>() { return View(); }
+	operator View2D<const T>() const { return View(); }
+
+private:
+	//    ALIGNMENT 迡   ̸ ø
+	static size_t AlignedStride(int w) {
+		if (ALIGNMENT % sizeof(T) != 0) return static_cast<size_t>(w);
+		const size_t perLine = ALIGNMENT / sizeof(T);
+		return (static_cast<size_t>(w) + perLine - 1) / perLine * perLine;
+	}
+
+	void CopyFrom(const Buffer2D& other) {
+		Create(other.width, other.height);
+		if (other.data) std::memcpy(data, other.data, stride * height * sizeof(T));
+	}
+
+	void Swap(Buffer2D& other) {
+		std::swap(storage, other.storage);
+		std::swap(data, other.data);
+		std::swap(width, other.width);
+		std::swap(height, other.height);
+		std::swap(stride, other.stride);
+		std::swap(capacity, other.capacity);
+	}
+
+	unsigned char* storage = nullptr; // new[]   ּ ()
+	T* data = nullptr;                // ALIGNMENT ĵ ù 
+	int width = 0;
+	int height = 0;
+	size_t stride = 0;                //  
+	size_t capacity = 0;              // data   ִ Ʈ 
+};
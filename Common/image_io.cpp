@@ -0,0 +1,328 @@
+#include "image_io_backend.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+
+namespace imageio {
+
+	const char* StatusMessage(Status status)
+	{
+		switch (status) {
+		case Status::Ok:                return "ok";
+		case Status::OpenFailed:        return "cannot open or read the file";
+		case Status::UnsupportedFormat: return "unsupported image format (backend not built in)";
+		case Status::DecodeFailed:      return "corrupt or truncated image";
+		case Status::EncodeFailed:      return "cannot encode or write the image";
+		}
+		return "unknown error";
+	}
+
+	Decoder::State::~State()
+	{
+#if IMAGE_IO_USE_LIBJPEG
+		if (jpeg) detail::DestroyJpegDecoder(jpeg);
+#endif
+	}
+
+	namespace {
+
+		enum class FileType { Unknown, Png, Jpeg, Netpbm };
+
+		FileType DetectFileType(const uint8_t* data, size_t size)
+		{
+			static const uint8_t pngSignature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+			if (size >= 8 && std::memcmp(data, pngSignature, 8) == 0) return FileType::Png;
+			if (size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF) return FileType::Jpeg;
+			if (size >= 2 && data[0] == 'P' && (data[1] == '5' || data[1] == '6')) return FileType::Netpbm;
+			return FileType::Unknown;
+		}
+
+		// ҹ Ȯ ( ),   ڿ
+		std::string Extension(const std::string& path)
+		{
+			size_t dot = path.find_last_of('.');
+			size_t slash = path.find_last_of("/\\");
+			if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) return "";
+			std::string ext = path.substr(dot + 1);
+			for (auto& c : ext) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+			return ext;
+		}
+
+		// netpbm    ( # ּ ǳʶ)
+		bool ReadHeaderInt(const uint8_t* data, size_t size, size_t& pos, int& value)
+		{
+			while (pos < size) {
+				if (data[pos] == '#') {
+					while (pos < size && data[pos] != '\n') ++pos;
+				}
+				else if (std::isspace(data[pos])) {
+					++pos;
+				}
+				else {
+					break;
+				}
+			}
+			if (pos >= size || !std::isdigit(data[pos])) return false;
+			long long v = 0;
+			while (pos < size && std::isdigit(data[pos])) {
+				v = v * 10 + (data[pos++] - '0');
+				if (v > (1 << 24)) return false;
+			}
+			value = static_cast<int>(v);
+			return true;
+		}
+
+		// P5 () / P6 (RGB), maxval 255 
+		Status DecodeNetpbm(const uint8_t* data, size_t size, Image& out, PixelFormat format, Decoder::State& state)
+		{
+			int srcChannels = data[1] == '5' ? 1 : 3;
+			size_t pos = 2;
+			int width, height, maxval;
+			if (!ReadHeaderInt(data, size, pos, width) || !ReadHeaderInt(data, size, pos, height) ||
+				!ReadHeaderInt(data, size, pos, maxval)) {
+				return Status::DecodeFailed;
+			}
+			if (maxval > 255) return Status::UnsupportedFormat;   // 16Ʈ netpbm
+			if (width <= 0 || height <= 0 || maxval <= 0 || pos >= size || !std::isspace(data[pos])) {
+				return Status::DecodeFailed;
+			}
+			++pos;   //     
+
+			size_t srcStride = static_cast<size_t>(width) * srcChannels;
+			if ((size - pos) / srcStride < static_cast<size_t>(height)) return Status::DecodeFailed;
+
+			out.Create(width, height, format);
+			if (maxval != 255) state.rowBytes.resize(srcStride);
+
+			for (int y = 0; y < height; ++y) {
+				const uint8_t* src = data + pos + y * srcStride;
+				if (maxval != 255) {
+					// 0..maxval -> 0..255
+					for (size_t i = 0; i < srcStride; ++i) {
+						state.rowBytes[i] = static_cast<uint8_t>(std::min(src[i], static_cast<uint8_t>(maxval)) * 255 / maxval);
+					}
+					src = state.rowBytes.data();
+				}
+
+				uint8_t* dst = out.Row(y);
+				if (srcChannels == out.channels) {
+					if (srcChannels == 1) std::memcpy(dst, src, srcStride);
+					else detail::SwapRedBlue(src, dst, width);
+				}
+				else if (srcChannels == 1) {
+					detail::GrayRowToBgr(src, dst, width);
+				}
+				else {
+					detail::ColorRowToGray(src, dst, width);
+				}
+			}
+			return Status::Ok;
+		}
+
+		Status EncodeNetpbm(const std::string& path, const Image& image)
+		{
+			FILE* file = std::fopen(path.c_str(), "wb");
+			if (!file) return Status::EncodeFailed;
+
+			bool ok = std::fprintf(file, "P%c\n%d %d\n255\n", image.channels == 1 ? '5' : '6',
+				image.width, image.height) > 0;
+			std::vector<uint8_t> rgb(image.channels == 3 ? image.Stride() : 0);
+			for (int y = 0; ok && y < image.height; ++y) {
+				const uint8_t* row = image.Row(y);
+				if (image.channels == 3) {
+					detail::SwapRedBlue(row, rgb.data(), image.width);
+					row = rgb.data();
+				}
+				ok = std::fwrite(row, 1, image.Stride(), file) == image.Stride();
+			}
+			ok = std::fclose(file) == 0 && ok;
+			return ok ? Status::Ok : Status::EncodeFailed;
+		}
+	}
+
+	Decoder::Decoder() : state(new State()) {}
+
+	Decoder::~Decoder() = default;
+
+	Status Decoder::Decode(const std::string& path, Image& out, PixelFormat format)
+	{
+		FILE* file = std::fopen(path.c_str(), "rb");
+		if (!file) return Status::OpenFailed;
+
+		//  ۴ :  Ϻ Ŭ  þ
+		bool ok = std::fseek(file, 0, SEEK_END) == 0;
+		long size = ok ? std::ftell(file) : -1;
+		ok = size > 0 && std::fseek(file, 0, SEEK_SET) == 0;
+		if (ok) {
+			fileBytes.resize(static_cast<size_t>(size));
+			ok = std::fread(fileBytes.data(), 1, fileBytes.size(), file) == fileBytes.size();
+		}
+		std::fclose(file);
+		if (!ok) return Status::OpenFailed;
+
+		return DecodeMemory(fileBytes.data(), fileBytes.size(), out, format);
+	}
+
+	Status Decoder::DecodeMemory(const uint8_t* data, size_t size, Image& out, PixelFormat format)
+	{
+		switch (DetectFileType(data, size)) {
+		case FileType::Netpbm:
+			return DecodeNetpbm(data, size, out, format, *state);
+		case FileType::Png:
+#if IMAGE_IO_USE_LIBPNG
+			return detail::DecodePng(data, size, out, format, *state);
+#endif
+			break;
+		case FileType::Jpeg:
+#if IMAGE_IO_USE_LIBJPEG
+			return detail::DecodeJpeg(data, size, out, format, *state);
+#endif
+			break;
+		case FileType::Unknown:
+			break;
+		}
+#if IMAGE_IO_USE_GDIPLUS
+		//  鿣尡   GDI+ ó (BMP, GIF, TIFF )
+		return detail::DecodeGdiplus(data, size, out, format, *state);
+#else
+		return Status::UnsupportedFormat;
+#endif
+	}
+
+	Status Load(const std::string& path, Image& out, PixelFormat format)
+	{
+		Decoder decoder;
+		return decoder.Decode(path, out, format);
+	}
+
+	Status Save(const std::string& path, const Image& image)
+	{
+		if (image.Empty() || (image.channels != 1 && image.channels != 3)) return Status::EncodeFailed;
+
+		std::string ext = Extension(path);
+		if (ext == "pgm" || ext == "ppm" || ext == "pnm") {
+			return EncodeNetpbm(path, image);
+		}
+		if (ext == "png") {
+#if IMAGE_IO_USE_LIBPNG
+			return detail::EncodePng(path, image);
+#elif IMAGE_IO_USE_GDIPLUS
+			return detail::EncodeGdiplus(path, image, L"image/png");
+#endif
+		}
+		else if (ext == "jpg" || ext == "jpeg") {
+#if IMAGE_IO_USE_LIBJPEG
+			return detail::EncodeJpeg(path, image);
+#elif IMAGE_IO_USE_GDIPLUS
+			return detail::EncodeGdiplus(path, image, L"image/jpeg");
+#endif
+		}
+#if IMAGE_IO_USE_GDIPLUS
+		else if (ext == "bmp") {
+			return detail::EncodeGdiplus(path, image, L"image/bmp");
+		}
+#endif
+		return Status::UnsupportedFormat;
+	}
+
+	Session::Session()
+	{
+#if IMAGE_IO_USE_GDIPLUS
+		token = detail::StartGdiplus();
+#endif
+	}
+
+	Session::~Session()
+	{
+#if IMAGE_IO_USE_GDIPLUS
+		detail::StopGdiplus(token);
+#endif
+	}
+
+	namespace {
+
+		inline void PutPixel(Image& image, int x, int y, Color color)
+		{
+			if (x < 0 || y < 0 || x >= image.width || y >= image.height) return;
+			uint8_t* p = image.Row(y) + x * image.channels;
+			if (image.channels == 3) {
+				p[0] = color.b;
+				p[1] = color.g;
+				p[2] = color.r;
+			}
+			else {
+				p[0] = static_cast<uint8_t>((color.b + color.g + color.r) / 3);
+			}
+		}
+
+		// Cohen-Sutherland  ڵ
+		int OutCode(double x, double y, double xMin, double yMin, double xMax, double yMax)
+		{
+			return (x < xMin ? 1 : 0) | (x > xMax ? 2 : 0) | (y < yMin ? 4 : 0) | (y > yMax ? 8 : 0);
+		}
+
+		//  簢  ڸ.  ̸ false
+		bool ClipSegment(double& x1, double& y1, double& x2, double& y2,
+			double xMin, double yMin, double xMax, double yMax)
+		{
+			int c1 = OutCode(x1, y1, xMin, yMin, xMax, yMax);
+			int c2 = OutCode(x2, y2, xMin, yMin, xMax, yMax);
+			while (c1 | c2) {
+				if (c1 & c2) return false;
+				int c = c1 ? c1 : c2;
+				double x, y;
+				if (c & 8)      { x = x1 + (x2 - x1) * (yMax - y1) / (y2 - y1); y = yMax; }
+				else if (c & 4) { x = x1 + (x2 - x1) * (yMin - y1) / (y2 - y1); y = yMin; }
+				else if (c & 2) { y = y1 + (y2 - y1) * (xMax - x1) / (x2 - x1); x = xMax; }
+				else            { y = y1 + (y2 - y1) * (xMin - x1) / (x2 - x1); x = xMin; }
+				if (c == c1) { x1 = x; y1 = y; c1 = OutCode(x1, y1, xMin, yMin, xMax, yMax); }
+				else         { x2 = x; y2 = y; c2 = OutCode(x2, y2, xMin, yMin, xMax, yMax); }
+			}
+			return true;
+		}
+	}
+
+	void DrawLine(Image& image, int x1, int y1, int x2, int y2, Color color, int thickness)
+	{
+		if (image.Empty()) return;
+		thickness = std::max(1, thickness);
+		int lo = -(thickness - 1) / 2;
+		int hi = thickness / 2;
+
+		// ȭ     ׷ κи ȸϵ ̸ ڸ
+		double fx1 = x1, fy1 = y1, fx2 = x2, fy2 = y2;
+		if (!ClipSegment(fx1, fy1, fx2, fy2, lo, lo, image.width - 1.0 - lo, image.height - 1.0 - lo)) return;
+		int ax = static_cast<int>(std::lround(fx1)), ay = static_cast<int>(std::lround(fy1));
+		int bx = static_cast<int>(std::lround(fx2)), by = static_cast<int>(std::lround(fy2));
+
+		// Bresenham,   thickness x thickness 簢 
+		int dx = std::abs(bx - ax), sx = ax < bx ? 1 : -1;
+		int dy = -std::abs(by - ay), sy = ay < by ? 1 : -1;
+		int err = dx + dy;
+		while (true) {
+			for (int oy = lo; oy <= hi; ++oy) {
+				for (int ox = lo; ox <= hi; ++ox) {
+					PutPixel(image, ax + ox, ay + oy, color);
+				}
+			}
+			if (ax == bx && ay == by) break;
+			int e2 = 2 * err;
+			if (e2 >= dy) { err += dy; ax += sx; }
+			if (e2 <= dx) { err += dx; ay += sy; }
+		}
+	}
+
+	void FillCircle(Image& image, int cx, int cy, int radius, Color color)
+	{
+		for (int dy = -radius; dy <= radius; ++dy) {
+			for (int dx = -radius; dx <= radius; ++dx) {
+				if (dx * dx + dy * dy <= radius * radius) {
+					PutPixel(image, cx + dx, cy + dy, color);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,148 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ÷  ̹  (Project2, Project3 )
+// ȼ ׻ е  ӵ 8Ʈ ۷ ְް, ڵ    鿣尡 ó
+//
+//  - PGM/PPM (P5/P6): , ׻  
+//  - PNG: libpng (IMAGE_IO_USE_LIBPNG=1) Ǵ GDI+
+//  - JPEG: libjpeg / libjpeg-turbo (IMAGE_IO_USE_LIBJPEG=1) Ǵ GDI+
+//  - GDI+: Windows ⺻ 鿣 (IMAGE_IO_USE_GDIPLUS=0    ), BMP/GIF/TIFF ó
+//
+// Linux   (Project2/Project2 ):
+//   g++ -O2 -std=c++14 -pthread -DIMAGE_IO_USE_LIBPNG=1 -DIMAGE_IO_USE_LIBJPEG=1
+//       *.cpp ../../Common/image_io*.cpp -lpng -ljpeg -o hough
+
+#ifndef IMAGE_IO_USE_GDIPLUS
+#ifdef _WIN32
+#define IMAGE_IO_USE_GDIPLUS 1
+#else
+#define IMAGE_IO_USE_GDIPLUS 0
+#endif
+#endif
+
+#ifndef IMAGE_IO_USE_LIBPNG
+#define IMAGE_IO_USE_LIBPNG 0
+#endif
+
+#ifndef IMAGE_IO_USE_LIBJPEG
+#define IMAGE_IO_USE_LIBJPEG 0
+#endif
+
+namespace imageio {
+
+	// ڵ  ȼ  ( = ä )
+	enum class PixelFormat {
+		Gray8 = 1,  //  1Ʈ
+		BGR8 = 3    // B, G, R  3Ʈ (GDI+ PixelFormat24bppRGB ޸ ġ )
+	};
+
+	enum class Status {
+		Ok,
+		OpenFailed,         //  ų   
+		UnsupportedFormat,  //    ̰ų ش 鿣尡 忡 Ե 
+		DecodeFailed,       // ջ 
+		EncodeFailed        // ڵ Ǵ   
+	};
+
+	const char* StatusMessage(Status status);
+
+	// 8Ʈ ̹:  켱, е  (stride = width * channels)
+	//  Image   ڵ ϸ ۰  Ŀ   Ҵ
+	struct Image {
+		int width = 0;
+		int height = 0;
+		int channels = 0;
+		std::vector<uint8_t> pixels;
+
+		void Create(int w, int h, PixelFormat format) {
+			width = w;
+			height = h;
+			channels = static_cast<int>(format);
+			pixels.resize(static_cast<size_t>(w) * h * channels);
+		}
+		bool Empty() const { return width == 0 || height == 0; }
+		PixelFormat Format() const { return static_cast<PixelFormat>(channels); }
+		size_t Stride() const { return static_cast<size_t>(width) * channels; }
+		uint8_t* Row(int y) { return pixels.data() + y * Stride(); }
+		const uint8_t* Row(int y) const { return pixels.data() + y * Stride(); }
+	};
+
+	/**
+	 * @brief  ̹  ڵϱ  ڴ.
+	 *         ,  , JPEG ڴ ¸ ̹ ̿ ϹǷ
+	 *        ũⰡ  ̹ ݺ ó  ڵ  Ҵ  Ͼ .
+	 *        帶 ϳ  (   Ұ).
+	 */
+	class Decoder {
+	public:
+		Decoder();
+		~Decoder();
+		Decoder(const Decoder&) = delete;
+		Decoder& operator=(const Decoder&) = delete;
+
+		/**
+		 * @brief  ڵմϴ.   (ñ״ó) Ǻմϴ.
+		 * @param path ̹  
+		 * @param out [] ڵ ̹ (  )
+		 * @param format Gray8̸ ÷ ̹   ٷ  ȯ ((B+G+R)/3,  )Ͽ
+		 *               ÷ ü   .  ̹ ȯ  ״ .
+		 */
+		Status Decode(const std::string& path, Image& out, PixelFormat format);
+
+		// ޸𸮿 ִ   ڵ
+		Status DecodeMemory(const uint8_t* data, size_t size, Image& out, PixelFormat format);
+
+		struct State;
+
+	private:
+		std::vector<uint8_t> fileBytes;   //    
+		std::unique_ptr<State> state;     // 鿣庰   ( , JPEG ڴ)
+	};
+
+	/**
+	 * @brief  ϳ ڵմϴ (ȸ Decoder ).
+	 */
+	Status Load(const std::string& path, Image& out, PixelFormat format);
+
+	/**
+	 * @brief ̹ Ϸ մϴ.  Ȯڷ մϴ (.png, .jpg/.jpeg, .pgm/.ppm/.pnm, GDI+ .bmp).
+	 *        netpbm ä   P5 () Ǵ P6 (÷) մϴ.
+	 */
+	Status Save(const std::string& path, const Image& image);
+
+	/**
+	 * @brief 鿣 ʱȭ/Ḧ   Ŭ (GDI+ 鿣忡 GdiplusStartup/Shutdown).
+	 *        main   ϳ Ͽ α׷   մϴ.
+	 */
+	class Session {
+	public:
+		Session();
+		~Session();
+		Session(const Session&) = delete;
+		Session& operator=(const Session&) = delete;
+
+	private:
+		uintptr_t token = 0;
+	};
+
+	// ׸  (Gray8 ̹ (B+G+R)/3  ׷)
+	struct Color {
+		uint8_t b, g, r;
+	};
+
+	/**
+	 * @brief β ִ  ׸ϴ. ̹   κ ߸ϴ.
+	 * @param thickness  β (ȼ)
+	 */
+	void DrawLine(Image& image, int x1, int y1, int x2, int y2, Color color, int thickness);
+
+	/**
+	 * @brief  ä  ׸ϴ.
+	 */
+	void FillCircle(Image& image, int cx, int cy, int radius, Color color);
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "image_io.h"
+
+// image_io ο: 鿣  ϵ (image_io_*.cpp)   
+
+namespace imageio {
+
+	struct JpegDecoder;   // image_io_libjpeg.cpp
+
+	// Decoder ̹ ̿ ϴ 
+	struct Decoder::State {
+		std::vector<uint8_t> rowBytes;        // ȯ    (Ǵ interlace PNG ü )
+		std::vector<uint8_t*> rowPointers;    // interlace PNG  
+		JpegDecoder* jpeg = nullptr;          // ó JPEG   ,  
+
+		~State();
+	};
+
+	namespace detail {
+
+		//   ȼ ȯ.   GDI+ ڵ  (B+G+R)/3 ( )
+		inline void ColorRowToGray(const uint8_t* src, uint8_t* dst, int width) {
+			for (int x = 0; x < width; ++x) {
+				dst[x] = static_cast<uint8_t>((src[x * 3] + src[x * 3 + 1] + src[x * 3 + 2]) / 3);
+			}
+		}
+
+		inline void GrayRowToBgr(const uint8_t* src, uint8_t* dst, int width) {
+			for (int x = 0; x < width; ++x) {
+				dst[x * 3] = dst[x * 3 + 1] = dst[x * 3 + 2] = src[x];
+			}
+		}
+
+		// RGB <-> BGR (ڱ ڽſ ȯص )
+		inline void SwapRedBlue(const uint8_t* src, uint8_t* dst, int width) {
+			for (int x = 0; x < width; ++x) {
+				uint8_t r = src[x * 3];
+				dst[x * 3 + 1] = src[x * 3 + 1];
+				dst[x * 3] = src[x * 3 + 2];
+				dst[x * 3 + 2] = r;
+			}
+		}
+
+#if IMAGE_IO_USE_LIBPNG
+		Status DecodePng(const uint8_t* data, size_t size, Image& out, PixelFormat format, Decoder::State& state);
+		Status EncodePng(const std::string& path, const Image& image);
+#endif
+
+#if IMAGE_IO_USE_LIBJPEG
+		Status DecodeJpeg(const uint8_t* data, size_t size, Image& out, PixelFormat format, Decoder::State& state);
+		Status EncodeJpeg(const std::string& path, const Image& image);
+		void DestroyJpegDecoder(JpegDecoder* jpeg);
+#endif
+
+#if IMAGE_IO_USE_GDIPLUS
+		Status DecodeGdiplus(const uint8_t* data, size_t size, Image& out, PixelFormat format, Decoder::State& state);
+		Status EncodeGdiplus(const std::string& path, const Image& image, const wchar_t* mimeType);
+		uintptr_t StartGdiplus();
+		void StopGdiplus(uintptr_t token);
+#endif
+	}
+}
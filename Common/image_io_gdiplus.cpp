@@ -0,0 +1,132 @@
+#include "image_io_backend.h"
+
+#if IMAGE_IO_USE_GDIPLUS
+#define NOMINMAX // std::min 浹   windows.h include  ó
+#include <windows.h>
+#include <gdiplus.h>
+#include <shlwapi.h>
+#include <cstring>
+#pragma comment (lib,"Gdiplus.lib")
+#pragma comment (lib,"Shlwapi.lib")
+
+namespace imageio {
+namespace detail {
+
+	namespace {
+
+		/**
+		 * @brief GDI+ ̹ ϱ  ʿ ڴ CLSID  ǥ Լ.
+		 * @param format ã ϴ ̹  (: L"image/png")
+		 * @param pClsid [] ã ڴ CLSID  
+		 * @return   0 ̻ ,   -1
+		 */
+		int GetEncoderClsid(const WCHAR* format, CLSID* pClsid)
+		{
+			UINT  num = 0;
+			UINT  size = 0;
+
+			Gdiplus::ImageCodecInfo* pImageCodecInfo = NULL;
+			Gdiplus::GetImageEncodersSize(&num, &size);
+			if (size == 0) return -1;
+
+			pImageCodecInfo = (Gdiplus::ImageCodecInfo*)(malloc(size));
+			if (pImageCodecInfo == NULL) return -1;
+
+			Gdiplus::GetImageEncoders(num, size, pImageCodecInfo);
+
+			for (UINT j = 0; j < num; ++j) {
+				if (wcscmp(pImageCodecInfo[j].MimeType, format) == 0) {
+					*pClsid = pImageCodecInfo[j].Clsid;
+					free(pImageCodecInfo);
+					return j;
+				}
+			}
+
+			free(pImageCodecInfo);
+			return -1;
+		}
+
+		// α׷  κа  ANSI ڵ  θ GDI+ ̵ ڿ ȯ
+		std::wstring WidePath(const std::string& path)
+		{
+			int length = MultiByteToWideChar(CP_ACP, 0, path.c_str(), -1, NULL, 0);
+			std::wstring wide(length > 0 ? length : 1, L'\0');
+			if (length > 0) MultiByteToWideChar(CP_ACP, 0, path.c_str(), -1, &wide[0], length);
+			wide.resize(wcslen(wide.c_str()));
+			return wide;
+		}
+	}
+
+	Status DecodeGdiplus(const uint8_t* data, size_t size, Image& out, PixelFormat format, Decoder::State& state)
+	{
+		//   ޸ Ʈ  GDI+ 
+		IStream* stream = SHCreateMemStream(data, static_cast<UINT>(size));
+		if (!stream) return Status::DecodeFailed;
+
+		Status status = Status::DecodeFailed;
+		{
+			Gdiplus::Bitmap bmp(stream);
+			if (bmp.GetLastStatus() == Gdiplus::Ok) {
+				UINT width = bmp.GetWidth();
+				UINT height = bmp.GetHeight();
+
+				Gdiplus::BitmapData bitmapData;
+				Gdiplus::Rect rect(0, 0, width, height);
+				// LockBits: GetPixel/SetPixel ξ , ȼ Ϳ  ϴ 
+				if (bmp.LockBits(&rect, Gdiplus::ImageLockModeRead, PixelFormat24bppRGB, &bitmapData) == Gdiplus::Ok) {
+					out.Create(static_cast<int>(width), static_cast<int>(height), format);
+					const BYTE* p = (const BYTE*)bitmapData.Scan0;
+					int stride = bitmapData.Stride;    //   ̹ Ͱ ϴ  Ʈ  (4Ʈ )
+
+					for (UINT y = 0; y < height; ++y) {
+						const BYTE* row = p + static_cast<ptrdiff_t>(y) * stride;
+						if (format == PixelFormat::BGR8) std::memcpy(out.Row(y), row, out.Stride());
+						else ColorRowToGray(row, out.Row(y), static_cast<int>(width));
+					}
+					bmp.UnlockBits(&bitmapData);
+					status = Status::Ok;
+				}
+			}
+		}
+		stream->Release();
+		return status;
+	}
+
+	Status EncodeGdiplus(const std::string& path, const Image& image, const wchar_t* mimeType)
+	{
+		Gdiplus::Bitmap bmp(image.width, image.height, PixelFormat24bppRGB);
+		Gdiplus::BitmapData bitmapData;
+		Gdiplus::Rect rect(0, 0, image.width, image.height);
+		if (bmp.LockBits(&rect, Gdiplus::ImageLockModeWrite, PixelFormat24bppRGB, &bitmapData) != Gdiplus::Ok) {
+			return Status::EncodeFailed;
+		}
+
+		BYTE* p = (BYTE*)bitmapData.Scan0;
+		int stride = bitmapData.Stride;
+		for (int y = 0; y < image.height; ++y) {
+			BYTE* row = p + static_cast<ptrdiff_t>(y) * stride;
+			if (image.channels == 3) std::memcpy(row, image.Row(y), image.Stride());
+			else GrayRowToBgr(image.Row(y), row, image.width);
+		}
+		bmp.UnlockBits(&bitmapData);
+
+		CLSID clsid;
+		if (GetEncoderClsid(mimeType, &clsid) < 0) return Status::UnsupportedFormat;
+		return bmp.Save(WidePath(path).c_str(), &clsid, NULL) == Gdiplus::Ok ? Status::Ok : Status::EncodeFailed;
+	}
+
+	uintptr_t StartGdiplus()
+	{
+		Gdiplus::GdiplusStartupInput gdiplusStartupInput;
+		ULONG_PTR gdiplusToken = 0;
+		Gdiplus::GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, NULL);
+		return static_cast<uintptr_t>(gdiplusToken);
+	}
+
+	void StopGdiplus(uintptr_t token)
+	{
+		if (token) Gdiplus::GdiplusShutdown(static_cast<ULONG_PTR>(token));
+	}
+}
+}
+#endif
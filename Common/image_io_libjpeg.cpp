@@ -0,0 +1,131 @@
+#include "image_io_backend.h"
+
+#if IMAGE_IO_USE_LIBJPEG
+#include <csetjmp>
+#include <cstdio>
+#include <jpeglib.h>
+
+namespace imageio {
+
+	// libjpeg  ó: error_exit longjmp ڵ Լ ƿ
+	struct JpegError {
+		jpeg_error_mgr manager;
+		std::jmp_buf jump;
+	};
+
+	// ڴ ü  ޸ Ǯ ̹ ̿  (jpeg_abort ʱȭ)
+	struct JpegDecoder {
+		jpeg_decompress_struct info;
+		JpegError error;
+	};
+
+namespace detail {
+
+	namespace {
+
+		void ExitWithError(j_common_ptr info)
+		{
+			JpegError* error = reinterpret_cast<JpegError*>(info->err);
+			std::longjmp(error->jump, 1);
+		}
+
+		// longjmp ̹Ƿ Ҹڰ ִ    
+		bool ReadScanlines(JpegDecoder& jpeg, const uint8_t* data, size_t size,
+			Image& out, PixelFormat format, Decoder::State& state)
+		{
+			jpeg_decompress_struct& info = jpeg.info;
+			if (setjmp(jpeg.error.jump)) {
+				jpeg_abort_decompress(&info);
+				return false;
+			}
+
+			jpeg_mem_src(&info, const_cast<unsigned char*>(data), static_cast<unsigned long>(size));
+			jpeg_read_header(&info, TRUE);
+			//  JPEG  ״ (Y ä), ÷ RGB Ǯ ึ ȯ
+			info.out_color_space = info.num_components == 1 ? JCS_GRAYSCALE : JCS_RGB;
+			jpeg_start_decompress(&info);
+
+			int width = static_cast<int>(info.output_width);
+			int height = static_cast<int>(info.output_height);
+			int srcChannels = info.output_components;
+			out.Create(width, height, format);
+			state.rowBytes.resize(static_cast<size_t>(width) * srcChannels);
+
+			while (info.output_scanline < info.output_height) {
+				int y = static_cast<int>(info.output_scanline);
+				bool direct = srcChannels == 1 && format == PixelFormat::Gray8;
+				JSAMPROW row = direct ? out.Row(y) : state.rowBytes.data();
+				jpeg_read_scanlines(&info, &row, 1);
+				if (direct) continue;
+
+				if (srcChannels == 1) GrayRowToBgr(row, out.Row(y), width);
+				else if (format == PixelFormat::Gray8) ColorRowToGray(row, out.Row(y), width);
+				else SwapRedBlue(row, out.Row(y), width);
+			}
+			jpeg_finish_decompress(&info);
+			return true;
+		}
+
+		bool WriteScanlines(jpeg_compress_struct& info, JpegError& error, FILE* file,
+			const Image& image, uint8_t* rgb)
+		{
+			if (setjmp(error.jump)) return false;
+
+			jpeg_stdio_dest(&info, file);
+			info.image_width = image.width;
+			info.image_height = image.height;
+			info.input_components = image.channels;
+			info.in_color_space = image.channels == 1 ? JCS_GRAYSCALE : JCS_RGB;
+			jpeg_set_defaults(&info);
+			jpeg_set_quality(&info, 95, TRUE);
+			jpeg_start_compress(&info, TRUE);
+			while (info.next_scanline < info.image_height) {
+				JSAMPROW row = const_cast<JSAMPROW>(image.Row(static_cast<int>(info.next_scanline)));
+				if (image.channels == 3) {
+					SwapRedBlue(row, rgb, image.width);
+					row = rgb;
+				}
+				jpeg_write_scanlines(&info, &row, 1);
+			}
+			jpeg_finish_compress(&info);
+			return true;
+		}
+	}
+
+	Status DecodeJpeg(const uint8_t* data, size_t size, Image& out, PixelFormat format, Decoder::State& state)
+	{
+		if (!state.jpeg) {
+			state.jpeg = new JpegDecoder();
+			state.jpeg->info.err = jpeg_std_error(&state.jpeg->error.manager);
+			state.jpeg->error.manager.error_exit = ExitWithError;
+			jpeg_create_decompress(&state.jpeg->info);
+		}
+		return ReadScanlines(*state.jpeg, data, size, out, format, state) ? Status::Ok : Status::DecodeFailed;
+	}
+
+	void DestroyJpegDecoder(JpegDecoder* jpeg)
+	{
+		jpeg_destroy_decompress(&jpeg->info);
+		delete jpeg;
+	}
+
+	Status EncodeJpeg(const std::string& path, const Image& image)
+	{
+		FILE* file = std::fopen(path.c_str(), "wb");
+		if (!file) return Status::EncodeFailed;
+
+		jpeg_compress_struct info;
+		JpegError error;
+		info.err = jpeg_std_error(&error.manager);
+		error.manager.error_exit = ExitWithError;
+		jpeg_create_compress(&info);
+
+		std::vector<uint8_t> rgb(image.Stride());
+		bool ok = WriteScanlines(info, error, file, image, rgb.data());
+		jpeg_destroy_compress(&info);
+		ok = std::fclose(file) == 0 && ok;
+		return ok ? Status::Ok : Status::EncodeFailed;
+	}
+}
+}
+#endif
@@ -0,0 +1,136 @@
+#include "image_io_backend.h"
+
+#if IMAGE_IO_USE_LIBPNG
+#include <png.h>
+#include <cstdio>
+#include <cstring>
+
+namespace imageio {
+namespace detail {
+
+	namespace {
+
+		struct MemoryReader {
+			const uint8_t* data;
+			size_t size;
+			size_t pos;
+		};
+
+		void ReadFromMemory(png_structp png, png_bytep dst, png_size_t length)
+		{
+			MemoryReader* reader = static_cast<MemoryReader*>(png_get_io_ptr(png));
+			if (length > reader->size - reader->pos) {
+				png_error(png, "unexpected end of data");
+			}
+			std::memcpy(dst, reader->data + reader->pos, length);
+			reader->pos += length;
+		}
+
+		// libpng  longjmp ƿǷ, setjmp Ŀ Ҹڰ ִ    
+		bool ReadRows(png_structp png, png_infop info, Image& out, PixelFormat format, Decoder::State& state)
+		{
+			if (setjmp(png_jmpbuf(png))) return false;
+
+			png_read_info(png, info);
+			png_uint_32 width = png_get_image_width(png, info);
+			png_uint_32 height = png_get_image_height(png, info);
+			int colorType = png_get_color_type(png, info);
+
+			// 8Ʈ  Ǵ 8Ʈ RGB ȭ, Ĵ  (GDI+ 24bppRGB ȯ )
+			png_set_strip_16(png);
+			png_set_strip_alpha(png);
+			if (colorType == PNG_COLOR_TYPE_PALETTE) png_set_palette_to_rgb(png);
+			if (colorType == PNG_COLOR_TYPE_GRAY || colorType == PNG_COLOR_TYPE_GRAY_ALPHA) {
+				png_set_expand_gray_1_2_4_to_8(png);
+				if (format == PixelFormat::BGR8) png_set_gray_to_rgb(png);
+			}
+			if (format == PixelFormat::BGR8) png_set_bgr(png);
+			int passes = png_set_interlace_handling(png);
+			png_read_update_info(png, info);
+
+			int srcChannels = png_get_channels(png, info);
+			out.Create(static_cast<int>(width), static_cast<int>(height), format);
+			bool direct = srcChannels == out.channels;   // ->, ÷->BGR
+
+			if (direct) {
+				//  ۿ ٷ ڵ
+				state.rowPointers.resize(height);
+				for (png_uint_32 y = 0; y < height; ++y) state.rowPointers[y] = out.Row(static_cast<int>(y));
+				png_read_image(png, state.rowPointers.data());
+			}
+			else if (passes == 1) {
+				// ÷ -> :  ྿ о ٷ ȯ (÷  ü  )
+				state.rowBytes.resize(static_cast<size_t>(width) * srcChannels);
+				for (png_uint_32 y = 0; y < height; ++y) {
+					png_read_row(png, state.rowBytes.data(), NULL);
+					ColorRowToGray(state.rowBytes.data(), out.Row(static_cast<int>(y)), static_cast<int>(width));
+				}
+			}
+			else {
+				// interlace ÷ -> :  pass   ϼǹǷ ÷  ħ
+				size_t srcStride = static_cast<size_t>(width) * srcChannels;
+				state.rowBytes.resize(srcStride * height);
+				state.rowPointers.resize(height);
+				for (png_uint_32 y = 0; y < height; ++y) state.rowPointers[y] = state.rowBytes.data() + y * srcStride;
+				png_read_image(png, state.rowPointers.data());
+				for (png_uint_32 y = 0; y < height; ++y) {
+					ColorRowToGray(state.rowPointers[y], out.Row(static_cast<int>(y)), static_cast<int>(width));
+				}
+			}
+			png_read_end(png, NULL);
+			return true;
+		}
+
+		bool WriteRows(png_structp png, png_infop info, FILE* file, const Image& image, png_bytep* rows)
+		{
+			if (setjmp(png_jmpbuf(png))) return false;
+
+			png_init_io(png, file);
+			png_set_IHDR(png, info, image.width, image.height, 8,
+				image.channels == 1 ? PNG_COLOR_TYPE_GRAY : PNG_COLOR_TYPE_RGB,
+				PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+			png_write_info(png, info);
+			if (image.channels == 3) png_set_bgr(png);
+			png_write_image(png, rows);
+			png_write_end(png, NULL);
+			return true;
+		}
+	}
+
+	Status DecodePng(const uint8_t* data, size_t size, Image& out, PixelFormat format, Decoder::State& state)
+	{
+		png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+		if (!png) return Status::DecodeFailed;
+		png_infop info = png_create_info_struct(png);
+		if (!info) {
+			png_destroy_read_struct(&png, NULL, NULL);
+			return Status::DecodeFailed;
+		}
+
+		MemoryReader reader = { data, size, 0 };
+		png_set_read_fn(png, &reader, ReadFromMemory);
+		bool ok = ReadRows(png, info, out, format, state);
+		png_destroy_read_struct(&png, &info, NULL);
+		return ok ? Status::Ok : Status::DecodeFailed;
+	}
+
+	Status EncodePng(const std::string& path, const Image& image)
+	{
+		FILE* file = std::fopen(path.c_str(), "wb");
+		if (!file) return Status::EncodeFailed;
+
+		png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+		png_infop info = png ? png_create_info_struct(png) : NULL;
+		bool ok = false;
+		if (info) {
+			std::vector<png_bytep> rows(image.height);
+			for (int y = 0; y < image.height; ++y) rows[y] = const_cast<png_bytep>(image.Row(y));
+			ok = WriteRows(png, info, file, image, rows.data());
+		}
+		png_destroy_write_struct(&png, &info);
+		ok = std::fclose(file) == 0 && ok;
+		return ok ? Status::Ok : Status::EncodeFailed;
+	}
+}
+}
+#endif
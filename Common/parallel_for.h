@@ -0,0 +1,48 @@
+#pragma once
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+//   ݺ (Project2, Project3 )
+// [begin, end)   ŭ ӵ      尡 ó.
+//   ġ Ƿ  尡 ڱ  ¸  ȭ ʿ .
+
+/**
+ * @brief  ۾   մϴ.
+ * @param requested û   (0 ̸ CPU ھ )
+ * @param workItems  ۾   (  ̺  )
+ */
+inline int ResolveThreadCount(int requested, int workItems)
+{
+	int threads = requested > 0 ? requested : static_cast<int>(std::thread::hardware_concurrency());
+	threads = std::min(threads, workItems);
+	return std::max(threads, 1);
+}
+
+/**
+ * @brief [begin, end) numThreads    body(chunkBegin, chunkEnd, chunkIndex)  մϴ.
+ *          ȣ 尡  óϰ,    ȯմϴ.
+ * @param numThreads   (0 ̸ CPU ھ )
+ */
+template <typename Body>
+void ParallelFor(int begin, int end, int numThreads, Body body)
+{
+	int count = end - begin;
+	if (count <= 0) return;
+	int chunks = ResolveThreadCount(numThreads, count);
+	if (chunks == 1) {
+		body(begin, end, 0);
+		return;
+	}
+
+	std::vector<std::thread> workers;
+	workers.reserve(chunks - 1);
+	for (int i = 0; i < chunks; ++i) {
+		//  ũ ̴ ִ 1
+		int chunkBegin = begin + static_cast<int>(static_cast<long long>(count) * i / chunks);
+		int chunkEnd = begin + static_cast<int>(static_cast<long long>(count) * (i + 1) / chunks);
+		if (i == chunks - 1) body(chunkBegin, chunkEnd, i);
+		else workers.emplace_back(body, chunkBegin, chunkEnd, i);
+	}
+	for (auto& worker : workers) worker.join();
+}
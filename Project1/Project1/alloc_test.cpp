@@ -0,0 +1,164 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <cstdlib>
+#include "opencv2/opencv.hpp"
+#include "custom_cv.h"
+#include "custom_cv_alloc.h"
+#include "custom_cv_alloc_hook.h"     // 이 프로그램의 operator new를 집계 (한 TU에서만 포함)
+#include "synthetic_workload.h"
+
+// 정상 상태(steady state) 할당 검증
+// 워크스페이스를 재사용하는 호출이 워밍업 이후 프레임마다 버퍼를 새로 잡지 않는지 확인
+// 사용법: alloc_test [--frames N]
+//
+// 판정 기준
+//  - cv::Mat 데이터 버퍼 할당: 0회
+//  - 그 밖의 힙 할당 (operator new): 0회
+//  - 검증은 cv::setNumThreads(1)에서 수행하고, 기본 스레드 풀 수치는 참고용으로만 출력
+//    스레드 풀에서는 parallel_for_ 호출마다 OpenCV 백엔드가 작업 객체를 힙에 만들고
+//    (정적 링크나 Linux에서는 이 hook에 집계됨), 스레드별 scratch와 stripe별 작업 목록이
+//    어느 작업 스레드가 어떤 구간을 맡는지에 따라 처음 커지는 시점이 달라져 0회를 보장할 수 없음
+//  - 일반 Harris 경로 (ksize/blockSize가 fused 커널 조합이 아닌 경우)는
+//    가우시안 커널 생성 때문에 할당이 남아 있어 검증 대상에서 제외
+
+struct CheckResult {
+    std::string name;
+    custom_cv::alloc::AllocationCounts perCall;     // 측정 구간 최댓값
+    bool checked;                                   // false: 참고용
+};
+
+// 워밍업 후 frames회 호출하여 한 호출당 할당 최댓값 측정
+static custom_cv::alloc::AllocationCounts measure(int frames, const std::function<void()>& fn) {
+    for (int i = 0; i < 3; i++) {
+        fn();
+    }
+
+    custom_cv::alloc::AllocationCounts worst;
+    custom_cv::alloc::setCountingEnabled(true);
+    for (int i = 0; i < frames; i++) {
+        custom_cv::alloc::AllocationScope scope;
+        fn();
+        custom_cv::alloc::AllocationCounts c = scope.counts();
+        if (c.total() > worst.total() || c.matBytes + c.heapBytes > worst.matBytes + worst.heapBytes) {
+            worst = c;
+        }
+    }
+    custom_cv::alloc::setCountingEnabled(false);
+    return worst;
+}
+
+static bool passed(const CheckResult& r) {
+    return r.perCall.matAllocations == 0 && r.perCall.heapAllocations == 0;
+}
+
+int main(int argc, char** argv) {
+    int frames = 10;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) {
+            frames = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::cerr << "사용법: alloc_test [--frames N]" << std::endl;
+            return 2;
+        }
+    }
+
+    // 합성 영상 (직선 + 코너 + 노이즈)
+    synthetic::WorkloadSpec spec;
+    spec.size = cv::Size(1280, 720);
+    spec.numLines = 8;
+    spec.numCorners = 16;
+    spec.rotationDeg = 12.0;
+    spec.noiseSigma = 4.0;
+    spec.edgeDensity = 0.02;
+    cv::Mat image;
+    synthetic::GroundTruth gt;
+    synthetic::generate(spec, image, gt);
+
+    cv::Mat denseEdges;
+    cv::Canny(image, denseEdges, 170, 200);
+
+    std::vector<CheckResult> results;
+    const int savedThreads = cv::getNumThreads();
+
+    for (int pass = 0; pass < 2; pass++) {
+        // pass 0: 단일 스레드 (검증), pass 1: 기본 스레드 수 (참고용)
+        bool checked = pass == 0;
+        cv::setNumThreads(checked ? 1 : savedThreads);
+        std::string suffix = checked ? "" : " [threads=" + std::to_string(cv::getNumThreads()) + "]";
+
+        // 워크스페이스와 출력은 측정 구간 밖에서 소유 (프레임 간 재사용)
+        custom_cv::HarrisWorkspace harrisWs;
+        custom_cv::CannyWorkspace cannyWs;
+        custom_cv::HoughWorkspace houghWs;
+        custom_cv::EdgeList edgeList;
+        custom_cv::FrameAnalyzer analyzer;
+        cv::Mat harris, response, edges;
+        std::vector<cv::Vec2f> lines;
+
+        results.push_back({ "cornerHarris(ws) ksize=3 block=5" + suffix, measure(frames, [&]() {
+            custom_cv::cornerHarris(image, harris, 5, 3, 0.01, harrisWs);
+        }), checked });
+
+        results.push_back({ "cornerHarrisResponse(ws)" + suffix, measure(frames, [&]() {
+            custom_cv::cornerHarrisResponse(image, response, 5, 3, 0.01, harrisWs);
+        }), checked });
+
+        results.push_back({ "Canny(EdgeList, ws) + HoughLines(ws)" + suffix, measure(frames, [&]() {
+            custom_cv::Canny(image, edgeList, 170, 200, cannyWs);
+            custom_cv::HoughLines(edgeList, lines, 1, CV_PI / 180, 80, houghWs);
+        }), checked });
+
+        results.push_back({ "HoughLines(dense, ws)" + suffix, measure(frames, [&]() {
+            custom_cv::HoughLines(denseEdges, lines, 1, CV_PI / 180, 80, houghWs);
+        }), checked });
+
+        results.push_back({ "FrameAnalyzer::analyze" + suffix, measure(frames, [&]() {
+            analyzer.analyze(image, edges, lines, harris);
+        }), checked });
+
+        // 워크스페이스 없는 기존 API: 호출마다 중간 버퍼를 새로 만드는 것이 정상 (참고용)
+        results.push_back({ "cornerHarris (no workspace)" + suffix, measure(frames, [&]() {
+            custom_cv::cornerHarris(image, harris, 5, 3, 0.01);
+        }), false });
+
+        results.push_back({ "HoughLines(dense, no workspace)" + suffix, measure(frames, [&]() {
+            custom_cv::HoughLines(denseEdges, lines, 1, CV_PI / 180, 80);
+        }), false });
+    }
+    cv::setNumThreads(savedThreads);
+
+    // 결과 출력
+    std::cout << "=== 정상 상태 할당 검증 (" << spec.size.width << "x" << spec.size.height
+              << ", " << frames << " 프레임, 호출당 최댓값) ===" << std::endl;
+    std::cout << std::left << std::setw(52) << "함수"
+              << std::right << std::setw(8) << "Mat" << std::setw(12) << "Mat bytes"
+              << std::setw(8) << "heap" << std::setw(12) << "heap bytes" << "  판정" << std::endl;
+
+    int failures = 0;
+    for (const auto& r : results) {
+        std::string verdict = "참고";
+        if (r.checked) {
+            bool ok = passed(r);
+            verdict = ok ? "✅ 통과" : "❌ 실패";
+            if (!ok) failures++;
+        }
+        std::cout << std::left << std::setw(52) << r.name
+                  << std::right << std::setw(8) << r.perCall.matAllocations
+                  << std::setw(12) << r.perCall.matBytes
+                  << std::setw(8) << r.perCall.heapAllocations
+                  << std::setw(12) << r.perCall.heapBytes
+                  << "  " << verdict << std::endl;
+    }
+
+    if (failures > 0) {
+        std::cout << std::endl << "❌ " << failures << "개 함수가 정상 상태에서 버퍼를 할당합니다" << std::endl;
+        return 1;
+    }
+    std::cout << std::endl << "✅ 워크스페이스 경로는 정상 상태에서 버퍼를 할당하지 않습니다" << std::endl;
+    return 0;
+}
@@ -47,10 +47,12 @@ int main() {
         
         // Custom HoughLines (수정된 threshold)
         std::vector<cv::Vec2f> lines_custom;
-        custom_cv::HoughLines(src_edge, lines_custom, 1, CV_PI / 180.0, 80);
+        custom_cv::HoughStats hough_stats;
+        custom_cv::HoughLines(src_edge, lines_custom, 1, CV_PI / 180.0, 80, &hough_stats);
         
         std::cout << "🔹 OpenCV HoughLines (threshold=400): " << lines_opencv.size() << "개 직선 검출" << std::endl;
-        std::cout << "🔹 Custom HoughLines (threshold=80):  " << lines_custom.size() << "개 직선 검출" << std::endl;
+        std::cout << "🔹 Custom HoughLines (threshold=80):  " << lines_custom.size() << "개 직선 검출"
+                  << " (후보 " << hough_stats.candidatePeaks << ", 중복 제거 " << hough_stats.suppressedDuplicates << ")" << std::endl;
         
         if (lines_opencv.size() > 0 && lines_custom.size() > 0) {
             std::cout << "✅ HoughLines 정상 작동 - threshold 최적화 완료!" << std::endl;
@@ -83,12 +85,14 @@ int main() {
         
         // Custom cornerHarris
         cv::Mat R_custom;
-        custom_cv::cornerHarris(shapes_src, R_custom, blockSize, kSize, k);
+        custom_cv::HarrisStats harris_stats;
+        custom_cv::cornerHarris(shapes_src, R_custom, blockSize, kSize, k, cv::BORDER_DEFAULT, &harris_stats);
         cv::threshold(R_custom, R_custom, 0.02, 0, cv::THRESH_TOZERO);
         std::vector<cv::Point> corners_custom = FindLocalExtrema(R_custom);
         
         std::cout << "🔹 OpenCV cornerHarris: " << corners_opencv.size() << "개 코너 검출" << std::endl;
-        std::cout << "🔹 Custom cornerHarris: " << corners_custom.size() << "개 코너 검출" << std::endl;
+        std::cout << "🔹 Custom cornerHarris: " << corners_custom.size() << "개 코너 검출"
+                  << " (필터 후 응답 범위: [" << harris_stats.minResponse << ", " << harris_stats.maxResponse << "])" << std::endl;
         
         // 회전된 도형 영역에서의 코너 검출 분석
         int opencv_rotated = 0, custom_rotated = 0;
@@ -0,0 +1,326 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <cstdlib>
+#include <cmath>
+#include "opencv2/opencv.hpp"
+#include "custom_cv.h"
+#include "custom_cv_dispatch.h"
+#include "custom_cv_trace.h"
+
+// 마이크로 벤치마크: custom_cv 커널 vs OpenCV 대응 함수
+// 사용법: benchmark [--out results.json] [--reps N] [--warmup N] [--quick] [--trace trace.json]
+// --trace: 단계별 구간을 Chrome trace JSON으로 저장 (chrome://tracing 또는 Perfetto에서 열기)
+
+// Original FindLocalExtrema (main.cpp와 동일)
+std::vector<cv::Point> FindLocalExtrema(cv::Mat& src) {
+    cv::Mat dilatedImg, localMaxImg;
+    cv::Size sz(7, 7);
+    cv::Mat rectKernel = cv::getStructuringElement(cv::MORPH_RECT, sz);
+
+    cv::dilate(src, dilatedImg, rectKernel);
+    localMaxImg = (src == dilatedImg);
+
+    cv::Mat erodedImg, localMinImg;
+    cv::erode(src, erodedImg, rectKernel);
+    localMinImg = (src > erodedImg);
+
+    cv::Mat localExtremaImg = (localMaxImg & localMinImg);
+
+    std::vector<cv::Point> points;
+
+    for (int y = 0; y < localExtremaImg.rows; ++y) {
+        for (int x = 0; x < localExtremaImg.cols; ++x) {
+            uchar val = localExtremaImg.at<uchar>(y, x);
+            if (val) points.push_back(cv::Point(x, y));
+        }
+    }
+    return points;
+}
+
+struct BenchConfig {
+    int warmup = 3;
+    int reps = 20;
+    std::string outPath = "benchmark_results.json";
+    std::string tracePath;      // 비어 있으면 추적 안 함
+    std::vector<cv::Size> sizes = { cv::Size(640, 480), cv::Size(1280, 720), cv::Size(1920, 1080), cv::Size(3840, 2160) };
+    std::vector<int> threads;
+};
+
+struct BenchResult {
+    std::string kernel;
+    std::string impl;           // "custom" 또는 "opencv"
+    std::string params;         // JSON 객체 문자열
+    cv::Size size;
+    int threads;
+    double medianMs, p95Ms, meanMs, minMs;
+};
+
+// warmup 후 reps회 측정하여 중앙값/p95/평균/최소 (ms)
+static BenchResult measure(const BenchConfig& cfg, const std::function<void()>& fn) {
+    std::vector<double> samples;
+    samples.reserve(cfg.reps);
+    for (int i = 0; i < cfg.warmup; i++) {
+        fn();
+    }
+    for (int i = 0; i < cfg.reps; i++) {
+        int64 start = cv::getTickCount();
+        fn();
+        samples.push_back((cv::getTickCount() - start) * 1000.0 / cv::getTickFrequency());
+    }
+    std::sort(samples.begin(), samples.end());
+
+    BenchResult r;
+    size_t n = samples.size();
+    r.medianMs = n % 2 ? samples[n / 2] : 0.5 * (samples[n / 2 - 1] + samples[n / 2]);
+    r.p95Ms = samples[std::min(n - 1, static_cast<size_t>(std::ceil(0.95 * n)) - 1)];
+    double sum = 0;
+    for (double s : samples) sum += s;
+    r.meanMs = sum / n;
+    r.minMs = samples.front();
+    return r;
+}
+
+// 선, 회전된 사각형, 노이즈가 섞인 결정적(seed 고정) 테스트 영상
+static cv::Mat makeTestImage(cv::Size size) {
+    cv::Mat img(size, CV_8UC1, cv::Scalar(30));
+    cv::RNG rng(12345);
+    int numShapes = std::max(10, size.area() / 40000);
+
+    for (int i = 0; i < numShapes; i++) {
+        cv::Point p1(rng.uniform(0, size.width), rng.uniform(0, size.height));
+        if (i % 3 == 0) {
+            cv::Point p2(rng.uniform(0, size.width), rng.uniform(0, size.height));
+            cv::line(img, p1, p2, cv::Scalar(220), 2);
+        } else {
+            cv::RotatedRect rect(p1, cv::Size2f(rng.uniform(20.f, 120.f), rng.uniform(20.f, 120.f)),
+                                 rng.uniform(0.f, 90.f));
+            cv::Point2f v[4];
+            rect.points(v);
+            std::vector<cv::Point> poly(v, v + 4);
+            cv::fillConvexPoly(img, poly, cv::Scalar(rng.uniform(120, 255)));
+        }
+    }
+
+    cv::Mat noise(size, CV_8UC1);
+    cv::randn(noise, 0, 8);
+    cv::add(img, noise, img);
+    return img;
+}
+
+static std::string jsonEscape(const std::string& s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+static void writeJson(const BenchConfig& cfg, const std::vector<BenchResult>& results) {
+    std::ofstream out(cfg.outPath);
+    if (!out) {
+        std::cerr << "결과 파일을 열 수 없습니다: " << cfg.outPath << std::endl;
+        return;
+    }
+
+    out << std::fixed << std::setprecision(4);
+    out << "{\n";
+    out << "  \"meta\": {\n";
+    out << "    \"opencv_version\": \"" << CV_VERSION << "\",\n";
+    out << "    \"cpu_variant\": \"" << custom_cv::dispatch::kernelTable().name << "\",\n";
+    out << "    \"hardware_threads\": " << cv::getNumberOfCPUs() << ",\n";
+    out << "    \"warmup\": " << cfg.warmup << ",\n";
+    out << "    \"reps\": " << cfg.reps << "\n";
+    out << "  },\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        out << "    {\"kernel\": \"" << jsonEscape(r.kernel) << "\", \"impl\": \"" << r.impl << "\""
+            << ", \"width\": " << r.size.width << ", \"height\": " << r.size.height
+            << ", \"threads\": " << r.threads << ", \"params\": " << r.params
+            << ", \"median_ms\": " << r.medianMs << ", \"p95_ms\": " << r.p95Ms
+            << ", \"mean_ms\": " << r.meanMs << ", \"min_ms\": " << r.minMs << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+int main(int argc, char** argv) {
+    BenchConfig cfg;
+    bool quick = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--out" && i + 1 < argc) cfg.outPath = argv[++i];
+        else if (arg == "--reps" && i + 1 < argc) cfg.reps = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--warmup" && i + 1 < argc) cfg.warmup = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--quick") quick = true;
+        else if (arg == "--trace" && i + 1 < argc) cfg.tracePath = argv[++i];
+        else {
+            std::cerr << "알 수 없는 옵션: " << arg << std::endl;
+            return -1;
+        }
+    }
+
+    if (quick) {
+        cfg.sizes = { cv::Size(640, 480), cv::Size(1280, 720) };
+        cfg.reps = std::min(cfg.reps, 5);
+    }
+
+    if (!cfg.tracePath.empty()) {
+        custom_cv::trace::setEnabled(true);
+    }
+
+    int maxThreads = cv::getNumberOfCPUs();
+    for (int t = 1; t < maxThreads; t *= 2) cfg.threads.push_back(t);
+    cfg.threads.push_back(maxThreads);
+
+    std::cout << "📊 custom_cv 마이크로 벤치마크" << std::endl;
+    std::cout << "=============================" << std::endl;
+    std::cout << "CPU variant: " << custom_cv::dispatch::kernelTable().name
+              << ", warmup " << cfg.warmup << ", reps " << cfg.reps << std::endl;
+
+    std::vector<BenchResult> results;
+    auto record = [&](const std::string& kernel, const std::string& impl, const std::string& params,
+                      cv::Size size, int threads, const std::function<void()>& fn) {
+        BenchResult r = measure(cfg, fn);
+        r.kernel = kernel;
+        r.impl = impl;
+        r.params = params;
+        r.size = size;
+        r.threads = threads;
+        results.push_back(r);
+
+        std::cout << std::left << std::setw(26) << kernel << std::setw(8) << impl
+                  << std::setw(11) << (std::to_string(size.width) + "x" + std::to_string(size.height))
+                  << "t=" << std::setw(3) << threads << std::setw(40) << params
+                  << std::right << std::fixed << std::setprecision(3)
+                  << " median " << std::setw(9) << r.medianMs << " ms"
+                  << "  p95 " << std::setw(9) << r.p95Ms << " ms" << std::endl;
+    };
+
+    for (const cv::Size& size : cfg.sizes) {
+        cv::Mat src = makeTestImage(size);
+        cv::Mat srcFloat;
+        src.convertTo(srcFloat, CV_32F, 1.0 / 255.0);
+        cv::Mat edges;
+        cv::Canny(src, edges, 170, 200);
+
+        for (int threads : cfg.threads) {
+            cv::setNumThreads(threads);
+
+            // HoughLines
+            for (int threshold : { 80, 200 }) {
+                std::string params = "{\"rho\": 1, \"theta_deg\": 1, \"threshold\": " + std::to_string(threshold) + "}";
+                std::vector<cv::Vec2f> lines;
+                record("HoughLines", "custom", params, size, threads, [&]() {
+                    custom_cv::HoughLines(edges, lines, 1, CV_PI / 180.0, threshold);
+                });
+                record("HoughLines", "opencv", params, size, threads, [&]() {
+                    cv::HoughLines(edges, lines, 1, CV_PI / 180.0, threshold);
+                });
+            }
+
+            // cornerHarris (특수화된 조합과 일반 경로)
+            const int combos[][2] = { { 3, 3 }, { 3, 5 }, { 5, 5 }, { 7, 7 } };
+            for (const auto& combo : combos) {
+                int ksize = combo[0];
+                int blockSize = combo[1];
+                std::string params = "{\"ksize\": " + std::to_string(ksize) +
+                                     ", \"blockSize\": " + std::to_string(blockSize) + ", \"k\": 0.04}";
+                cv::Mat R;
+                custom_cv::HarrisWorkspace ws;
+                record("cornerHarris", "custom", params, size, threads, [&]() {
+                    custom_cv::cornerHarris(src, R, blockSize, ksize, 0.04, ws);
+                });
+                record("cornerHarris", "opencv", params, size, threads, [&]() {
+                    cv::cornerHarris(src, R, blockSize, ksize, 0.04);
+                });
+            }
+
+            // computeSobelDerivatives vs cv::Sobel
+            cv::Mat Ix, Iy, Ixx, Iyy, Ixy;
+            for (int ksize : { 3, 5, 7 }) {
+                std::string params = "{\"ksize\": " + std::to_string(ksize) + "}";
+                record("computeSobelDerivatives", "custom", params, size, threads, [&]() {
+                    custom_cv::computeSobelDerivatives(srcFloat, Ix, Iy, ksize);
+                });
+                record("computeSobelDerivatives", "opencv", params, size, threads, [&]() {
+                    cv::Sobel(srcFloat, Ix, CV_32F, 1, 0, ksize);
+                    cv::Sobel(srcFloat, Iy, CV_32F, 0, 1, ksize);
+                });
+            }
+
+            // applyGaussianWeighting vs cv::GaussianBlur (같은 입력 평면 재사용)
+            custom_cv::computeSobelDerivatives(srcFloat, Ix, Iy, 3);
+            custom_cv::computeDerivativeProducts(Ix, Iy, Ixx, Iyy, Ixy);
+            cv::Mat wxx, wyy, wxy;
+            for (int blockSize : { 3, 5, 7 }) {
+                std::string params = "{\"blockSize\": " + std::to_string(blockSize) + "}";
+                record("applyGaussianWeighting", "custom", params, size, threads, [&]() {
+                    Ixx.copyTo(wxx);
+                    Iyy.copyTo(wyy);
+                    Ixy.copyTo(wxy);
+                    custom_cv::applyGaussianWeighting(wxx, wyy, wxy, blockSize);
+                });
+                record("applyGaussianWeighting", "opencv", params, size, threads, [&]() {
+                    Ixx.copyTo(wxx);
+                    Iyy.copyTo(wyy);
+                    Ixy.copyTo(wxy);
+                    cv::GaussianBlur(wxx, wxx, cv::Size(blockSize, blockSize), 0);
+                    cv::GaussianBlur(wyy, wyy, cv::Size(blockSize, blockSize), 0);
+                    cv::GaussianBlur(wxy, wxy, cv::Size(blockSize, blockSize), 0);
+                });
+            }
+
+            // computeHarrisResponse vs OpenCV 행렬 연산 (det - k * trace^2)
+            cv::Mat response, det, xy2, trace;
+            record("computeHarrisResponse", "custom", "{\"k\": 0.04}", size, threads, [&]() {
+                custom_cv::computeHarrisResponse(Ixx, Iyy, Ixy, response, 0.04);
+            });
+            record("computeHarrisResponse", "opencv", "{\"k\": 0.04}", size, threads, [&]() {
+                cv::multiply(Ixx, Iyy, det);
+                cv::multiply(Ixy, Ixy, xy2);
+                cv::subtract(det, xy2, det);
+                cv::add(Ixx, Iyy, trace);
+                cv::multiply(trace, trace, trace);
+                cv::scaleAdd(trace, -0.04, det, response);
+            });
+
+            // 같은 7x7 응답 맵에서의 극대점 검출 (결과 정의가 달라 같은 커널 이름으로 비교하지 않음)
+            //  - FindLocalExtrema (main.cpp): 7x7 dilate 값과 같고 erode 값보다 큰 화소, 평탄 구간은 여러 점
+            //  - custom_cv::findLocalMaxima (radius 3): 엄격한 극대, 평탄 구간은 스캔 순서 첫 화소, 경계 3화소 제외
+            cv::Mat R;
+            cv::cornerHarris(src, R, 5, 3, 0.04);
+            cv::threshold(R, R, 0, 0, cv::THRESH_TOZERO);
+            std::vector<cv::Point> points;
+            record("findLocalMaxima", "custom", "{\"radius\": 3, \"threshold\": 0}", size, threads, [&]() {
+                custom_cv::findLocalMaxima(R, points, 0.0f, 3);
+            });
+            record("FindLocalExtrema", "opencv", "{\"window\": 7}", size, threads, [&]() {
+                points = FindLocalExtrema(R);
+            });
+        }
+    }
+
+    cv::setNumThreads(-1);
+    writeJson(cfg, results);
+    std::cout << "\n✅ 결과 저장: " << cfg.outPath << " (" << results.size() << "개 측정)" << std::endl;
+
+    if (!cfg.tracePath.empty()) {
+        custom_cv::trace::setEnabled(false);
+        if (custom_cv::trace::exportChromeTrace(cfg.tracePath)) {
+            std::cout << "✅ 추적 저장: " << cfg.tracePath << std::endl;
+        } else {
+            std::cerr << "추적 파일을 쓸 수 없습니다: " << cfg.tracePath << std::endl;
+        }
+    }
+    return 0;
+}
@@ -1,7 +1,105 @@
 #include "opencv2/opencv.hpp"
+#include "synthetic_workload.h"
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdlib>
+
+// 사용법:
+//   create_test_images                      기본 테스트 이미지 2장 (lg_building.jpg, shapes1.jpg)
+//   create_test_images --set <출력 폴더>    스윕용 합성 영상 세트 + 정답 파일 + manifest.txt
+//       [--mp 0.25,1,4,16,64] [--lines 8] [--corners 16] [--rotations 0,15,30]
+//       [--noise 0,8] [--density 0,0.01] [--seed 12345]
+
+static std::vector<double> parseList(const std::string& text) {
+    std::vector<double> values;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) values.push_back(std::atof(item.c_str()));
+    }
+    return values;
+}
+
+// 0.25 MP ~ 64 MP, 4:3 비율, 파라미터 조합마다 영상과 정답(.yml) 저장
+static int createWorkloadSet(int argc, char** argv) {
+    std::string outDir = argv[2];
+    std::vector<double> megapixels = { 0.25, 1, 4, 16, 64 };
+    std::vector<double> rotations = { 0, 15, 30 };
+    std::vector<double> noises = { 0, 8 };
+    std::vector<double> densities = { 0, 0.01 };
+    synthetic::WorkloadSpec base;
+
+    for (int i = 3; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        std::string value = argv[i + 1];
+        if (arg == "--mp") megapixels = parseList(value);
+        else if (arg == "--lines") base.numLines = std::atoi(value.c_str());
+        else if (arg == "--corners") base.numCorners = std::atoi(value.c_str());
+        else if (arg == "--rotations") rotations = parseList(value);
+        else if (arg == "--noise") noises = parseList(value);
+        else if (arg == "--density") densities = parseList(value);
+        else if (arg == "--seed") base.seed = static_cast<uint64>(std::atoll(value.c_str()));
+        else {
+            std::cerr << "알 수 없는 옵션: " << arg << std::endl;
+            return -1;
+        }
+    }
+
+    std::ofstream manifest(outDir + "/manifest.txt");
+    if (!manifest) {
+        std::cerr << "출력 폴더에 쓸 수 없습니다: " << outDir << std::endl;
+        return -1;
+    }
+
+    int count = 0;
+    for (double mp : megapixels) {
+        int width = static_cast<int>(std::sqrt(mp * 1e6 * 4.0 / 3.0) + 0.5);
+        int height = static_cast<int>(width * 3 / 4);
+
+        for (double rotation : rotations) {
+            for (double noise : noises) {
+                for (double density : densities) {
+                    synthetic::WorkloadSpec spec = base;
+                    spec.size = cv::Size(width, height);
+                    spec.rotationDeg = rotation;
+                    spec.noiseSigma = noise;
+                    spec.edgeDensity = density;
+                    spec.seed = base.seed + count;
+
+                    cv::Mat image;
+                    synthetic::GroundTruth gt;
+                    synthetic::generate(spec, image, gt);
+
+                    std::ostringstream name;
+                    name << "synth_" << mp << "mp_r" << rotation << "_n" << noise << "_d" << density;
+                    std::string imagePath = outDir + "/" + name.str() + ".png";
+                    std::string truthPath = outDir + "/" + name.str() + ".yml";
+
+                    if (!cv::imwrite(imagePath, image) || !synthetic::writeGroundTruth(truthPath, spec, gt)) {
+                        std::cerr << "저장 실패: " << imagePath << std::endl;
+                        return -1;
+                    }
+                    manifest << imagePath << " " << truthPath << "\n";
+                    count++;
+
+                    std::cout << "- " << imagePath << " (" << width << "x" << height
+                              << ", 직선 " << gt.lines.size() << ", 코너 " << gt.corners.size() << ")" << std::endl;
+                }
+            }
+        }
+    }
+
+    std::cout << count << "개 합성 영상과 정답 파일이 생성되었습니다: " << outDir << "/manifest.txt" << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 3 && std::string(argv[1]) == "--set") {
+        return createWorkloadSet(argc, argv);
+    }
 
-int main() {
     // 1. lg_building.jpg 대체 이미지 생성 (Hough Lines 테스트용)
     cv::Mat building_img = cv::Mat::zeros(400, 600, CV_8UC1);
     
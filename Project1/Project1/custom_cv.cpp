@@ -1,21 +1,41 @@
 #include "custom_cv.h"
+#include "custom_cv_arena.h"
+#include "custom_cv_dispatch.h"
+#include "custom_cv_parallel.h"
+#include "custom_cv_trace.h"
+#include <opencv2/core/hal/intrin.hpp>
+#include <opencv2/core/utils/logger.hpp>
 #include <algorithm>
-#include <iostream>
+#include <atomic>
 
 namespace custom_cv {
 
-void HoughLines(const cv::Mat& image, std::vector<cv::Vec2f>& lines, 
-               double rho, double theta, int threshold) {
-    lines.clear();
-    
-    if (image.empty()) {
-        std::cerr << "Input image is empty!" << std::endl;
-        return;
+// The workspace-less overloads own their intermediates for a single call,
+// so those planes can come from the calling thread's frame arena
+static void useFrameArena(HoughWorkspace& ws) {
+    ws.accumulator.allocator = FrameArena::allocator();
+}
+
+static void useFrameArena(HarrisWorkspace& ws) {
+    for (cv::Mat* m : { &ws.srcFloat, &ws.Ix, &ws.Iy, &ws.Ixx, &ws.Iyy, &ws.Ixy, &ws.eroded }) {
+        m->allocator = FrameArena::allocator();
     }
-    
+}
+
+static void useFrameArena(CannyWorkspace& ws) {
+    for (cv::Mat* m : { &ws.dx, &ws.dy, &ws.magnitude, &ws.marks }) {
+        m->allocator = FrameArena::allocator();
+    }
+}
+
+// Voting and peak extraction shared by the dense and the edge-list entry points
+static void houghLinesFromPoints(const int* xs, const int* ys, size_t count, cv::Size imageSize,
+                                 std::vector<cv::Vec2f>& lines,
+                                 double rho, double theta, int threshold,
+                                 HoughWorkspace& ws, HoughStats* stats) {
     // Image dimensions
-    int width = image.cols;
-    int height = image.rows;
+    int width = imageSize.width;
+    int height = imageSize.height;
     
     // Calculate the maximum possible distance (diagonal of image)
     double maxDist = sqrt(width * width + height * height);
@@ -24,71 +44,83 @@ void HoughLines(const cv::Mat& image, std::vector<cv::Vec2f>& lines,
     int numAngles = static_cast<int>(CV_PI / theta);  // Number of angle bins
     int numRhos = static_cast<int>(2 * maxDist / rho) + 1; // Number of rho bins (add 1 for safety)
     
-    // Create accumulator array
-    cv::Mat accumulator = cv::Mat::zeros(numRhos, numAngles, CV_32SC1);
+    if (stats) {
+        stats->edgePixels = count;
+        stats->votesCast = count * static_cast<size_t>(numAngles);
+        stats->accumulatorSize = cv::Size(numAngles, numRhos);
+    }
     
-    // Fill accumulator
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            // Check if pixel is an edge pixel
-            if (image.at<uchar>(y, x) > 0) {
-                // For each angle
-                for (int t = 0; t < numAngles; t++) {
-                    double angle = t * theta;
-                    
-                    // Calculate rho for this angle and point
-                    double r = x * cos(angle) + y * sin(angle);
-                    
-                    // Convert rho to accumulator index
-                    int rhoIdx = static_cast<int>(round((r + maxDist) / rho));
-                    
-                    // Check bounds
-                    if (rhoIdx >= 0 && rhoIdx < numRhos) {
-                        accumulator.at<int>(rhoIdx, t)++;
-                    }
-                }
-            }
+    cv::Mat& accumulator = ws.accumulator;
+    {
+        CUSTOM_CV_STAGE_SCOPE("vote", stats ? &stats->voteNs : nullptr);
+        
+        // Create accumulator array (reuses the workspace buffer when the size matches)
+        accumulator.create(numRhos, numAngles, CV_32SC1);
+        accumulator.setTo(0);
+        
+        // Angle tables (same values as evaluating cos/sin per vote)
+        ws.cosTable.resize(numAngles);
+        ws.sinTable.resize(numAngles);
+        for (int t = 0; t < numAngles; t++) {
+            double angle = t * theta;
+            ws.cosTable[t] = cos(angle);
+            ws.sinTable[t] = sin(angle);
         }
+        
+        // Fill accumulator (CPU-dispatched kernel)
+        dispatch::houghVote(xs, ys, count, ws.cosTable.data(), ws.sinTable.data(), numAngles,
+                            maxDist, rho, accumulator);
     }
     
     // Find peaks using improved non-maximum suppression
-    std::vector<std::pair<int, std::pair<int, int>>> candidates; // votes, (r, t)
+    std::vector<std::pair<int, std::pair<int, int>>>& candidates = ws.candidates; // votes, (r, t)
+    candidates.clear();
     
-    for (int r = 1; r < numRhos - 1; r++) {
-        for (int t = 1; t < numAngles - 1; t++) {
-            int votes = accumulator.at<int>(r, t);
-            
-            if (votes >= threshold) {
-                // Check if this is a local maximum in 5x5 neighborhood
-                bool isLocalMax = true;
+    {
+        CUSTOM_CV_STAGE_SCOPE("peak extraction", stats ? &stats->peakNs : nullptr);
+        
+        for (int r = 1; r < numRhos - 1; r++) {
+            for (int t = 1; t < numAngles - 1; t++) {
+                int votes = accumulator.at<int>(r, t);
                 
-                for (int dr = -2; dr <= 2 && isLocalMax; dr++) {
-                    for (int dt = -2; dt <= 2 && isLocalMax; dt++) {
-                        if (dr == 0 && dt == 0) continue;
-                        
-                        int nr = r + dr;
-                        int nt = t + dt;
-                        
-                        // Handle theta wrapping
-                        if (nt < 0) nt = numAngles - 1;
-                        if (nt >= numAngles) nt = 0;
-                        
-                        // Check bounds for rho
-                        if (nr >= 0 && nr < numRhos) {
-                            if (accumulator.at<int>(nr, nt) > votes) {
-                                isLocalMax = false;
+                if (votes >= threshold) {
+                    // Check if this is a local maximum in 5x5 neighborhood
+                    bool isLocalMax = true;
+                    
+                    for (int dr = -2; dr <= 2 && isLocalMax; dr++) {
+                        for (int dt = -2; dt <= 2 && isLocalMax; dt++) {
+                            if (dr == 0 && dt == 0) continue;
+                            
+                            int nr = r + dr;
+                            int nt = t + dt;
+                            
+                            // Handle theta wrapping
+                            if (nt < 0) nt = numAngles - 1;
+                            if (nt >= numAngles) nt = 0;
+                            
+                            // Check bounds for rho
+                            if (nr >= 0 && nr < numRhos) {
+                                if (accumulator.at<int>(nr, nt) > votes) {
+                                    isLocalMax = false;
+                                }
                             }
                         }
                     }
-                }
-                
-                if (isLocalMax) {
-                    candidates.push_back({votes, {r, t}});
+                    
+                    if (isLocalMax) {
+                        candidates.push_back({votes, {r, t}});
+                    }
                 }
             }
         }
     }
     
+    if (stats) {
+        stats->candidatePeaks = candidates.size();
+    }
+    
+    CUSTOM_CV_STAGE_SCOPE("filtering", stats ? &stats->filterNs : nullptr);
+    
     // Sort candidates by votes (descending)
     std::sort(candidates.begin(), candidates.end(), std::greater<std::pair<int, std::pair<int, int>>>());
     
@@ -121,6 +153,7 @@ void HoughLines(const cv::Mat& image, std::vector<cv::Vec2f>& lines,
         // Skip diagonal lines if we want to match OpenCV behavior more closely
         // Comment out the next 3 lines if you want to keep diagonal lines
         if (!isHorizontalOrVertical) {
+            if (stats) stats->rejectedDiagonal++;
             continue;
         }
         
@@ -144,19 +177,91 @@ void HoughLines(const cv::Mat& image, std::vector<cv::Vec2f>& lines,
         if (!tooSimilar) {
             lines.push_back(cv::Vec2f(static_cast<float>(actualRho), 
                                     static_cast<float>(actualTheta)));
+        } else if (stats) {
+            stats->suppressedDuplicates++;
         }
         
         // Stop if we have enough lines
         if (lines.size() >= 20) break; // Reduced to 20 lines max
     }
     
-    std::cout << "Found " << lines.size() << " lines with threshold " << threshold << std::endl;
+    if (stats) {
+        stats->linesFound = lines.size();
+    }
 }
 
-void computeSobelDerivatives(const cv::Mat& src, cv::Mat& Ix, cv::Mat& Iy, int ksize) {
-    // Create Sobel kernels
-    cv::Mat sobelX, sobelY;
+void HoughLines(const cv::Mat& image, std::vector<cv::Vec2f>& lines, 
+               double rho, double theta, int threshold, HoughStats* stats) {
+    FrameArena::Scope frame;
+    HoughWorkspace ws;
+    useFrameArena(ws);
+    HoughLines(image, lines, rho, theta, threshold, ws, stats);
+}
+
+void HoughLines(const cv::Mat& image, std::vector<cv::Vec2f>& lines,
+                double rho, double theta, int threshold, HoughWorkspace& ws,
+                HoughStats* stats) {
+    CUSTOM_CV_TRACE_SCOPE("HoughLines");
+    lines.clear();
+    if (stats) {
+        *stats = HoughStats();
+    }
+    
+    if (image.empty()) {
+        CV_LOG_DEBUG(NULL, "custom_cv::HoughLines: input image is empty");
+        return;
+    }
+    
+    // Collect edge pixels, then vote
+    std::vector<int>& xs = ws.xs;
+    std::vector<int>& ys = ws.ys;
+    xs.clear();
+    ys.clear();
+    {
+        CUSTOM_CV_STAGE_SCOPE("collect edges", stats ? &stats->collectNs : nullptr);
+        for (int y = 0; y < image.rows; y++) {
+            const uchar* row = image.ptr<uchar>(y);
+            for (int x = 0; x < image.cols; x++) {
+                if (row[x] > 0) {
+                    xs.push_back(x);
+                    ys.push_back(y);
+                }
+            }
+        }
+    }
+    
+    houghLinesFromPoints(xs.data(), ys.data(), xs.size(), image.size(), lines, rho, theta, threshold,
+                         ws, stats);
+}
+
+void HoughLines(const EdgeList& edges, std::vector<cv::Vec2f>& lines,
+                double rho, double theta, int threshold, HoughStats* stats) {
+    FrameArena::Scope frame;
+    HoughWorkspace ws;
+    useFrameArena(ws);
+    HoughLines(edges, lines, rho, theta, threshold, ws, stats);
+}
+
+void HoughLines(const EdgeList& edges, std::vector<cv::Vec2f>& lines,
+                double rho, double theta, int threshold, HoughWorkspace& ws,
+                HoughStats* stats) {
+    CUSTOM_CV_TRACE_SCOPE("HoughLines");
+    lines.clear();
+    if (stats) {
+        *stats = HoughStats();
+    }
+    
+    if (edges.imageSize.area() == 0) {
+        CV_LOG_DEBUG(NULL, "custom_cv::HoughLines: edge list has no image size");
+        return;
+    }
     
+    houghLinesFromPoints(edges.x.data(), edges.y.data(), edges.size(), edges.imageSize,
+                         lines, rho, theta, threshold, ws, stats);
+}
+
+// Sobel kernels used by the dense and the sparse Harris paths
+static void createSobelKernels(int ksize, cv::Mat& sobelX, cv::Mat& sobelY) {
     if (ksize == 3) {
         // 3x3 Sobel kernels
         sobelX = (cv::Mat_<float>(3, 3) << 
@@ -183,9 +288,14 @@ void computeSobelDerivatives(const cv::Mat& src, cv::Mat& Ix, cv::Mat& Iy, int k
             0, 0, 0, 0, 0,
             2, 8, 12, 8, 2,
             1, 4, 6, 4, 1) / 48.0;
+    } else if (ksize == 7) {
+        // 7x7 Sobel kernels (smoothing x derivative taps), scaled like 5x5
+        cv::Mat smooth = (cv::Mat_<float>(7, 1) << 1, 6, 15, 20, 15, 6, 1);
+        cv::Mat deriv = (cv::Mat_<float>(7, 1) << -1, -4, -5, 0, 5, 4, 1);
+        sobelX = smooth * deriv.t() / 640.0;
+        sobelY = deriv * smooth.t() / 640.0;
     } else {
         // Default to 3x3
-        ksize = 3;
         sobelX = (cv::Mat_<float>(3, 3) << 
             -1, 0, 1,
             -2, 0, 2,
@@ -196,6 +306,35 @@ void computeSobelDerivatives(const cv::Mat& src, cv::Mat& Ix, cv::Mat& Iy, int k
              0,  0,  0,
              1,  2,  1);
     }
+}
+
+// Radius of the Sobel kernel createSobelKernels builds for ksize
+static int sobelRadius(int ksize) {
+    return (ksize == 5 || ksize == 7) ? ksize / 2 : 1;
+}
+
+// Scale createSobelKernels applies relative to the integer Sobel kernel
+static double sobelNormalization(int ksize) {
+    if (ksize == 5) return 1.0 / 48.0;
+    if (ksize == 7) return 1.0 / 640.0;
+    return 1.0;
+}
+
+// 2D Gaussian window used by the dense and the sparse Harris paths
+static cv::Mat createGaussianWindow(int blockSize) {
+    cv::Mat gaussian = cv::getGaussianKernel(blockSize, -1, CV_32F);
+    return gaussian * gaussian.t();
+}
+
+void computeSobelDerivatives(const cv::Mat& src, cv::Mat& Ix, cv::Mat& Iy, int ksize) {
+    // Separable kernels specialized at compile time for 3, 5 and 7
+    if (dispatch::sobelDerivatives(src, Ix, Iy, ksize)) {
+        return;
+    }
+    
+    // Create Sobel kernels
+    cv::Mat sobelX, sobelY;
+    createSobelKernels(ksize, sobelX, sobelY);
     
     // Apply convolution
     cv::filter2D(src, Ix, CV_32F, sobelX);
@@ -204,8 +343,7 @@ void computeSobelDerivatives(const cv::Mat& src, cv::Mat& Ix, cv::Mat& Iy, int k
 
 void applyGaussianWeighting(cv::Mat& Ixx, cv::Mat& Iyy, cv::Mat& Ixy, int blockSize) {
     // Create Gaussian kernel
-    cv::Mat gaussian = cv::getGaussianKernel(blockSize, -1, CV_32F);
-    cv::Mat gaussianKernel = gaussian * gaussian.t();
+    cv::Mat gaussianKernel = createGaussianWindow(blockSize);
     
     // Apply Gaussian weighting to each component
     cv::filter2D(Ixx, Ixx, CV_32F, gaussianKernel);
@@ -215,84 +353,1584 @@ void applyGaussianWeighting(cv::Mat& Ixx, cv::Mat& Iyy, cv::Mat& Ixy, int blockS
 
 void computeHarrisResponse(const cv::Mat& Ixx, const cv::Mat& Iyy, 
                           const cv::Mat& Ixy, cv::Mat& dst, double k) {
-    dst = cv::Mat::zeros(Ixx.size(), CV_32F);
-    
-    for (int y = 0; y < dst.rows; y++) {
-        for (int x = 0; x < dst.cols; x++) {
-            // Get matrix elements
-            float xx = Ixx.at<float>(y, x);
-            float yy = Iyy.at<float>(y, x);
-            float xy = Ixy.at<float>(y, x);
-            
-            // Compute determinant and trace
-            float det = xx * yy - xy * xy;
-            float trace = xx + yy;
+    // Every pixel is written below, so no zero-initialization is needed
+    dst.create(Ixx.size(), CV_32F);
+    
+    parallelFor(cv::Range(0, dst.rows), [&](const cv::Range& range) {
+        for (int y = range.start; y < range.end; y++) {
+            const float* xxRow = Ixx.ptr<float>(y);
+            const float* yyRow = Iyy.ptr<float>(y);
+            const float* xyRow = Ixy.ptr<float>(y);
+            float* dstRow = dst.ptr<float>(y);
             
-            // Harris response: det - k * trace^2
-            float response = det - k * trace * trace;
+            for (int x = 0; x < dst.cols; x++) {
+                // Get matrix elements
+                float xx = xxRow[x];
+                float yy = yyRow[x];
+                float xy = xyRow[x];
+                
+                // Compute determinant and trace
+                float det = xx * yy - xy * xy;
+                float trace = xx + yy;
+                
+                // Harris response: det - k * trace^2
+                float response = det - k * trace * trace;
+                
+                dstRow[x] = response;
+            }
+        }
+    });
+}
+
+void computeDerivativeProducts(const cv::Mat& Ix, const cv::Mat& Iy,
+                               cv::Mat& Ixx, cv::Mat& Iyy, cv::Mat& Ixy) {
+    Ixx.create(Ix.size(), CV_32F);
+    Iyy.create(Ix.size(), CV_32F);
+    Ixy.create(Ix.size(), CV_32F);
+    
+    // One read of Ix/Iy produces all three products
+    parallelFor(cv::Range(0, Ix.rows), [&](const cv::Range& range) {
+        for (int y = range.start; y < range.end; y++) {
+            const float* ixRow = Ix.ptr<float>(y);
+            const float* iyRow = Iy.ptr<float>(y);
+            float* xxRow = Ixx.ptr<float>(y);
+            float* yyRow = Iyy.ptr<float>(y);
+            float* xyRow = Ixy.ptr<float>(y);
             
-            dst.at<float>(y, x) = response;
+            for (int x = 0; x < Ix.cols; x++) {
+                float ix = ixRow[x];
+                float iy = iyRow[x];
+                xxRow[x] = ix * ix;
+                yyRow[x] = iy * iy;
+                xyRow[x] = ix * iy;
+            }
         }
-    }
+    });
 }
 
-void cornerHarris(const cv::Mat& src, cv::Mat& dst, int blockSize, 
-                 int ksize, double k, int borderType) {
-    if (src.empty()) {
-        std::cerr << "Input image is empty!" << std::endl;
-        return;
+void cornerHarrisResponse(const cv::Mat& src, cv::Mat& dst, int blockSize,
+                          int ksize, double k, HarrisWorkspace& ws, HarrisStats* stats) {
+    if (stats) {
+        *stats = HarrisStats();
     }
     
     // Convert to float if necessary
-    cv::Mat srcFloat;
-    if (src.type() != CV_32F) {
-        src.convertTo(srcFloat, CV_32F, 1.0/255.0); // Normalize to [0,1]
-    } else {
-        srcFloat = src.clone();
+    {
+        CUSTOM_CV_STAGE_SCOPE("convert", stats ? &stats->convertNs : nullptr);
+        if (src.type() != CV_32F) {
+            src.convertTo(ws.srcFloat, CV_32F, 1.0/255.0); // Normalize to [0,1]
+        } else {
+            src.copyTo(ws.srcFloat);
+        }
+    }
+    
+    // Steps 1-4 in one specialized kernel for the common (ksize, blockSize)
+    // combinations; the product planes Ixx/Iyy/Ixy are not written then
+    {
+        int64_t fusedNs = 0;
+        bool fused;
+        {
+            CUSTOM_CV_STAGE_SCOPE("sobel+products+window+response (fused)", stats ? &fusedNs : nullptr);
+            fused = dispatch::harrisResponse(ws.srcFloat, ws.Ix, ws.Iy, dst, ksize, blockSize, k);
+        }
+        if (fused) {
+            if (stats) {
+                stats->fused = true;
+                stats->responseNs += fusedNs;
+            }
+            return;
+        }
     }
     
     // Step 1: Compute image derivatives using Sobel
-    cv::Mat Ix, Iy;
-    computeSobelDerivatives(srcFloat, Ix, Iy, ksize);
+    {
+        CUSTOM_CV_STAGE_SCOPE("sobel", stats ? &stats->sobelNs : nullptr);
+        computeSobelDerivatives(ws.srcFloat, ws.Ix, ws.Iy, ksize);
+    }
     
     // Step 2: Compute products of derivatives
-    cv::Mat Ixx = Ix.mul(Ix);  // Ix^2
-    cv::Mat Iyy = Iy.mul(Iy);  // Iy^2
-    cv::Mat Ixy = Ix.mul(Iy);  // Ix * Iy
+    {
+        CUSTOM_CV_STAGE_SCOPE("products", stats ? &stats->productsNs : nullptr);
+        computeDerivativeProducts(ws.Ix, ws.Iy, ws.Ixx, ws.Iyy, ws.Ixy);
+    }
     
     // Step 3: Apply Gaussian weighting (windowing function)
-    applyGaussianWeighting(Ixx, Iyy, Ixy, blockSize);
+    {
+        CUSTOM_CV_STAGE_SCOPE("window", stats ? &stats->windowNs : nullptr);
+        applyGaussianWeighting(ws.Ixx, ws.Iyy, ws.Ixy, blockSize);
+    }
     
     // Step 4: Compute Harris response for each pixel
-    computeHarrisResponse(Ixx, Iyy, Ixy, dst, k);
+    CUSTOM_CV_STAGE_SCOPE("response", stats ? &stats->responseNs : nullptr);
+    computeHarrisResponse(ws.Ixx, ws.Iyy, ws.Ixy, dst, k);
+}
+
+void findLocalMaxima(const cv::Mat& response, std::vector<cv::Point>& points,
+                     float threshold, int radius) {
+    CV_Assert(response.type() == CV_32F && radius >= 1);
+    CUSTOM_CV_TRACE_SCOPE("local maxima");
+    points.clear();
     
-    // Step 5: Apply strict corner filtering
-    // Suppress weak responses that might come from curves
+    int innerRows = response.rows - 2 * radius;
+    int innerCols = response.cols - 2 * radius;
+    if (innerRows <= 0 || innerCols <= 0) {
+        return;
+    }
+    
+    // Each stripe collects its own maxima; concatenating them in stripe
+    // order keeps the output in row-major order
+    int numStripes = std::max(1, std::min(innerRows, cv::getNumThreads() * 4));
+    std::vector<std::vector<cv::Point>> stripePoints(numStripes);
+    
+    parallelFor(cv::Range(0, numStripes), [&](const cv::Range& range) {
+        for (int s = range.start; s < range.end; s++) {
+            int yBegin = radius + innerRows * s / numStripes;
+            int yEnd = radius + innerRows * (s + 1) / numStripes;
+            dispatch::localMaxima(response, cv::Rect(radius, yBegin, innerCols, yEnd - yBegin),
+                        threshold, radius, stripePoints[s]);
+        }
+    });
+    
+    for (const auto& stripe : stripePoints) {
+        points.insert(points.end(), stripe.begin(), stripe.end());
+    }
+}
+
+// Strict post-filter of cornerHarris: keep the top 10% of the range, remove
+// isolated responses and renormalize to [0,1].
+// The opening is a 3x3 erode + dilate that ignores pixels outside the image
+// (cv::morphologyEx defaults); eroded is reused scratch, so no temporaries.
+static void suppressWeakCorners(cv::Mat& dst, cv::Mat& eroded, HarrisStats* stats) {
+    const int rows = dst.rows;
+    const int cols = dst.cols;
     double minVal, maxVal;
-    cv::minMaxLoc(dst, &minVal, &maxVal);
+    std::atomic<size_t> aboveThreshold(0), afterMorphology(0);
     
-    // Apply much stricter thresholding to eliminate curve responses
-    double strictThreshold = maxVal * 0.1; // Only keep top 10% responses
-    cv::Mat mask = dst > strictThreshold;
-    dst.setTo(0, ~mask);
+    {
+        CUSTOM_CV_STAGE_SCOPE("threshold", stats ? &stats->thresholdNs : nullptr);
+        
+        // Suppress weak responses that might come from curves
+        cv::minMaxLoc(dst, &minVal, &maxVal);
+        
+        // Apply much stricter thresholding to eliminate curve responses
+        const float strictThreshold = static_cast<float>(maxVal * 0.1); // Only keep top 10% responses
+        parallelFor(cv::Range(0, rows), [&](const cv::Range& range) {
+            size_t kept = 0;
+            for (int y = range.start; y < range.end; y++) {
+                float* row = dst.ptr<float>(y);
+                for (int x = 0; x < cols; x++) {
+                    if (row[x] > strictThreshold) {
+                        kept++;
+                    } else {
+                        row[x] = 0.0f;
+                    }
+                }
+            }
+            aboveThreshold += kept;
+        });
+    }
     
-    // Additional morphological filtering to remove isolated points
-    cv::Mat kernel = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(3, 3));
-    cv::Mat filtered;
-    cv::morphologyEx(dst, filtered, cv::MORPH_OPEN, kernel);
+    {
+        CUSTOM_CV_STAGE_SCOPE("morphology", stats ? &stats->morphologyNs : nullptr);
+        
+        // Erode: 3x3 minimum. Clamping a neighbor index onto the center pixel
+        // leaves the minimum unchanged, which is how outside pixels are ignored.
+        eroded.create(dst.size(), CV_32F);
+        parallelFor(cv::Range(0, rows), [&](const cv::Range& range) {
+            for (int y = range.start; y < range.end; y++) {
+                const float* up = dst.ptr<float>(std::max(y - 1, 0));
+                const float* row = dst.ptr<float>(y);
+                const float* down = dst.ptr<float>(std::min(y + 1, rows - 1));
+                float* eRow = eroded.ptr<float>(y);
+                
+                for (int x = 0; x < cols; x++) {
+                    eRow[x] = std::min(std::min(up[x], row[x]), down[x]);
+                }
+                float prev = eRow[0];
+                for (int x = 0; x < cols; x++) {
+                    float cur = eRow[x];
+                    float next = x + 1 < cols ? eRow[x + 1] : cur;
+                    eRow[x] = std::min(std::min(prev, cur), next);
+                    prev = cur;
+                }
+            }
+        });
+        
+        // Dilate the eroded map (3x3 maximum) and only keep responses whose
+        // opening is positive, i.e. that survive morphological filtering
+        parallelFor(cv::Range(0, rows), [&](const cv::Range& range) {
+            size_t kept = 0;
+            for (int y = range.start; y < range.end; y++) {
+                const float* up = eroded.ptr<float>(std::max(y - 1, 0));
+                const float* row = eroded.ptr<float>(y);
+                const float* down = eroded.ptr<float>(std::min(y + 1, rows - 1));
+                float* dRow = dst.ptr<float>(y);
+                
+                float prev = std::max(std::max(up[0], row[0]), down[0]);
+                float cur = prev;
+                for (int x = 0; x < cols; x++) {
+                    float next = x + 1 < cols ? std::max(std::max(up[x + 1], row[x + 1]), down[x + 1]) : cur;
+                    if (std::max(std::max(prev, cur), next) > 0.0f) {
+                        kept++;
+                    } else {
+                        dRow[x] = 0.0f;
+                    }
+                    prev = cur;
+                    cur = next;
+                }
+            }
+            afterMorphology += kept;
+        });
+    }
     
-    // Only keep responses that survive morphological filtering
-    cv::Mat finalMask = filtered > 0;
-    dst.setTo(0, ~finalMask);
+    if (stats) {
+        stats->pixelsAboveThreshold = aboveThreshold;
+        stats->pixelsAfterMorphology = afterMorphology;
+    }
     
     // Renormalize after filtering
+    CUSTOM_CV_STAGE_SCOPE("normalize", stats ? &stats->normalizeNs : nullptr);
     cv::minMaxLoc(dst, &minVal, &maxVal);
+    if (stats) {
+        stats->minResponse = minVal;
+        stats->maxResponse = maxVal;
+    }
     if (maxVal > 0) {
-        dst = dst / maxVal;
+        dst.convertTo(dst, CV_32F, 1.0 / maxVal);
+    }
+}
+
+void cornerHarris(const cv::Mat& src, cv::Mat& dst, int blockSize, 
+                 int ksize, double k, int borderType, HarrisStats* stats) {
+    FrameArena::Scope frame;
+    HarrisWorkspace ws;
+    useFrameArena(ws);
+    cornerHarris(src, dst, blockSize, ksize, k, ws, borderType, stats);
+}
+
+void cornerHarris(const cv::Mat& src, cv::Mat& dst, int blockSize, 
+                 int ksize, double k, HarrisWorkspace& ws, int borderType,
+                 HarrisStats* stats) {
+    CUSTOM_CV_TRACE_SCOPE("cornerHarris");
+    if (stats) {
+        *stats = HarrisStats();
+    }
+    if (src.empty()) {
+        CV_LOG_DEBUG(NULL, "custom_cv::cornerHarris: input image is empty");
+        return;
+    }
+    
+    // Steps 1-4: Sobel derivatives, products, Gaussian window and response
+    cornerHarrisResponse(src, dst, blockSize, ksize, k, ws, stats);
+    
+    // Step 5: Apply strict corner filtering
+    suppressWeakCorners(dst, ws.eroded, stats);
+}
+
+// Offset of the vertex of the quadratic fitted to the 3x3 neighborhood of (x, y).
+// Returns false when the surface is not a proper maximum or the vertex lies
+// outside the neighborhood.
+static bool fitQuadraticPeak(const cv::Mat& response, int x, int y, cv::Point2f& offset) {
+    const float* up = response.ptr<float>(y - 1);
+    const float* row = response.ptr<float>(y);
+    const float* down = response.ptr<float>(y + 1);
+    
+    // First and second derivatives by central differences
+    float dx = 0.5f * (row[x + 1] - row[x - 1]);
+    float dy = 0.5f * (down[x] - up[x]);
+    float dxx = row[x + 1] + row[x - 1] - 2.0f * row[x];
+    float dyy = down[x] + up[x] - 2.0f * row[x];
+    float dxy = 0.25f * (down[x + 1] - down[x - 1] - up[x + 1] + up[x - 1]);
+    
+    // A maximum needs a negative definite Hessian
+    float det = dxx * dyy - dxy * dxy;
+    if (det <= 0 || dxx >= 0) return false;
+    
+    // offset = -H^-1 * gradient
+    float ox = -(dyy * dx - dxy * dy) / det;
+    float oy = -(dxx * dy - dxy * dx) / det;
+    if (std::abs(ox) > 1.0f || std::abs(oy) > 1.0f) return false;
+    
+    offset = cv::Point2f(ox, oy);
+    return true;
+}
+
+// Gradient-orthogonality refinement (same criterion as cv::cornerSubPix):
+// every gradient in the window is orthogonal to the vector from the corner
+// to its pixel, so the corner solves sum(w*g*g^T) q = sum(w*g*g^T p).
+static cv::Point2f refineWithGradients(const cv::Mat& Ix, const cv::Mat& Iy,
+                                       cv::Point2f start, const SubPixParams& params,
+                                       const std::vector<float>& weights) {
+    const int r = params.winRadius;
+    const int winSize = 2 * r + 1;
+    cv::Point2f q = start;
+    
+    for (int iter = 0; iter < params.maxIterations; iter++) {
+        int cx = cvRound(q.x);
+        int cy = cvRound(q.y);
+        if (cx - r < 0 || cy - r < 0 || cx + r >= Ix.cols || cy + r >= Ix.rows) break;
+        
+        double a = 0, b = 0, c = 0, bx = 0, by = 0;
+        for (int dy = -r; dy <= r; dy++) {
+            const float* gxRow = Ix.ptr<float>(cy + dy);
+            const float* gyRow = Iy.ptr<float>(cy + dy);
+            for (int dx = -r; dx <= r; dx++) {
+                double w = weights[(dy + r) * winSize + (dx + r)];
+                double gx = gxRow[cx + dx];
+                double gy = gyRow[cx + dx];
+                double gxx = w * gx * gx;
+                double gxy = w * gx * gy;
+                double gyy = w * gy * gy;
+                
+                a += gxx;
+                b += gxy;
+                c += gyy;
+                bx += gxx * (cx + dx) + gxy * (cy + dy);
+                by += gxy * (cx + dx) + gyy * (cy + dy);
+            }
+        }
+        
+        double det = a * c - b * b;
+        if (std::abs(det) <= 1e-12) break;
+        
+        cv::Point2f next(static_cast<float>((c * bx - b * by) / det),
+                         static_cast<float>((a * by - b * bx) / det));
+        float moveX = next.x - q.x;
+        float moveY = next.y - q.y;
+        q = next;
+        if (moveX * moveX + moveY * moveY < params.epsilon * params.epsilon) break;
+    }
+    
+    // Reject solutions that wandered out of the search window
+    if (std::abs(q.x - start.x) > r || std::abs(q.y - start.y) > r) {
+        return start;
+    }
+    return q;
+}
+
+void refineCornersSubPix(const cv::Mat& response, const HarrisWorkspace& ws,
+                         const std::vector<cv::Point>& peaks,
+                         std::vector<cv::Point2f>& corners,
+                         const SubPixParams& params) {
+    CV_Assert(response.type() == CV_32F && params.winRadius >= 1);
+    corners.resize(peaks.size());
+    if (peaks.empty()) return;
+    
+    // Gradient refinement needs the derivative planes of the same image
+    bool useGradients = params.iterative && !ws.Ix.empty() &&
+                        ws.Ix.size() == response.size() && ws.Iy.size() == response.size();
+    
+    // Gaussian window weights, shared by all corners
+    const int winSize = 2 * params.winRadius + 1;
+    std::vector<float> weights(winSize * winSize);
+    double sigma = std::max(1.0, params.winRadius * 0.5);
+    for (int dy = -params.winRadius; dy <= params.winRadius; dy++) {
+        for (int dx = -params.winRadius; dx <= params.winRadius; dx++) {
+            weights[(dy + params.winRadius) * winSize + (dx + params.winRadius)] =
+                static_cast<float>(std::exp(-(dx * dx + dy * dy) / (2.0 * sigma * sigma)));
+        }
+    }
+    
+    // Batched over all peaks; each corner is independent
+    int numPeaks = static_cast<int>(peaks.size());
+    parallelFor(cv::Range(0, numPeaks), [&](const cv::Range& range) {
+        for (int i = range.start; i < range.end; i++) {
+            const cv::Point& p = peaks[i];
+            cv::Point2f refined(static_cast<float>(p.x), static_cast<float>(p.y));
+            
+            // Step 1: Quadratic fit of the response surface
+            cv::Point2f offset;
+            if (p.x > 0 && p.y > 0 && p.x < response.cols - 1 && p.y < response.rows - 1 &&
+                fitQuadraticPeak(response, p.x, p.y, offset)) {
+                refined += offset;
+            }
+            
+            // Step 2: Optional iterative gradient refinement
+            if (useGradients) {
+                refined = refineWithGradients(ws.Ix, ws.Iy, refined, params, weights);
+            }
+            
+            corners[i] = refined;
+        }
+    }, numPeaks / 256.0);
+}
+
+// Bresenham circle of radius 3 used by the segment test (dx, dy);
+// entries 0, 4, 8 and 12 are the compass points
+static const int fastCircle[16][2] = {
+    {0, 3}, {1, 3}, {2, 2}, {3, 1}, {3, 0}, {3, -1}, {2, -2}, {1, -3},
+    {0, -3}, {-1, -3}, {-2, -2}, {-3, -1}, {-3, 0}, {-3, 1}, {-2, 2}, {-1, 3}
+};
+
+// True if the 16-bit circle mask contains arcLength contiguous set bits (with wrap-around)
+static bool hasContiguousArc(unsigned mask, int arcLength) {
+    unsigned wrapped = mask | (mask << 16);
+    unsigned run = wrapped;
+    for (int i = 1; i < arcLength && run; i++) {
+        run &= wrapped >> i;
+    }
+    return run != 0;
+}
+
+static bool fastSegmentTest(const uchar* ptr, const int* offsets, int threshold, int arcLength) {
+    int center = ptr[0];
+    unsigned brighter = 0, darker = 0;
+    
+    for (int i = 0; i < 16; i++) {
+        int v = ptr[offsets[i]];
+        if (v > center + threshold) brighter |= 1u << i;
+        else if (v < center - threshold) darker |= 1u << i;
+    }
+    return hasContiguousArc(brighter, arcLength) || hasContiguousArc(darker, arcLength);
+}
+
+void detectFASTCandidates(const cv::Mat& src, std::vector<cv::Point>& candidates,
+                          int threshold, int arcLength) {
+    CV_Assert(src.type() == CV_8UC1 && (arcLength == 9 || arcLength == 12));
+    candidates.clear();
+    
+    const int border = 3;
+    int innerRows = src.rows - 2 * border;
+    if (innerRows <= 0 || src.cols <= 2 * border) {
+        return;
+    }
+    threshold = std::min(std::max(threshold, 0), 255);
+    
+    int offsets[16];
+    for (int i = 0; i < 16; i++) {
+        offsets[i] = fastCircle[i][0] + fastCircle[i][1] * static_cast<int>(src.step);
+    }
+    
+    // An arc of 9 (12) out of 16 always covers at least 2 (3) compass points
+    const int minCompass = arcLength == 9 ? 2 : 3;
+    
+    int numStripes = std::max(1, std::min(innerRows, cv::getNumThreads() * 4));
+    std::vector<std::vector<cv::Point>> stripePoints(numStripes);
+    
+    parallelFor(cv::Range(0, numStripes), [&](const cv::Range& range) {
+        for (int s = range.start; s < range.end; s++) {
+            int yBegin = border + innerRows * s / numStripes;
+            int yEnd = border + innerRows * (s + 1) / numStripes;
+            std::vector<cv::Point>& out = stripePoints[s];
+            
+            for (int y = yBegin; y < yEnd; y++) {
+                const uchar* row = src.ptr<uchar>(y);
+                int x = border;
+                
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+                // Quick rejection on the compass points, one vector of centers at a time.
+                // Saturating add/sub keep "brighter than 255" and "darker than 0" impossible.
+                const int lanes = cv::VTraits<cv::v_uint8>::vlanes();
+                const cv::v_uint8 vThreshold = cv::vx_setall_u8(static_cast<uchar>(threshold));
+                const cv::v_uint8 vOne = cv::vx_setall_u8(1);
+                const cv::v_uint8 vMinCompass = cv::vx_setall_u8(static_cast<uchar>(minCompass));
+                uchar passMask[cv::VTraits<cv::v_uint8>::max_nlanes];
+                
+                for (; x <= src.cols - border - lanes; x += lanes) {
+                    cv::v_uint8 center = cv::vx_load(row + x);
+                    cv::v_uint8 upper = cv::v_add(center, vThreshold);
+                    cv::v_uint8 lower = cv::v_sub(center, vThreshold);
+                    cv::v_uint8 brightCount = cv::vx_setzero_u8();
+                    cv::v_uint8 darkCount = cv::vx_setzero_u8();
+                    
+                    for (int c = 0; c < 16; c += 4) {
+                        cv::v_uint8 p = cv::vx_load(row + x + offsets[c]);
+                        brightCount = cv::v_add(brightCount, cv::v_and(cv::v_gt(p, upper), vOne));
+                        darkCount = cv::v_add(darkCount, cv::v_and(cv::v_lt(p, lower), vOne));
+                    }
+                    
+                    cv::v_uint8 pass = cv::v_or(cv::v_ge(brightCount, vMinCompass),
+                                                cv::v_ge(darkCount, vMinCompass));
+                    if (!cv::v_check_any(pass)) continue;
+                    
+                    cv::v_store(passMask, pass);
+                    for (int i = 0; i < lanes; i++) {
+                        if (passMask[i] && fastSegmentTest(row + x + i, offsets, threshold, arcLength)) {
+                            out.push_back(cv::Point(x + i, y));
+                        }
+                    }
+                }
+#endif
+                
+                for (; x < src.cols - border; x++) {
+                    const uchar* ptr = row + x;
+                    int center = ptr[0];
+                    int brightCount = 0, darkCount = 0;
+                    for (int c = 0; c < 16; c += 4) {
+                        int v = ptr[offsets[c]];
+                        brightCount += v > center + threshold;
+                        darkCount += v < center - threshold;
+                    }
+                    if (brightCount < minCompass && darkCount < minCompass) continue;
+                    
+                    if (fastSegmentTest(ptr, offsets, threshold, arcLength)) {
+                        out.push_back(cv::Point(x, y));
+                    }
+                }
+            }
+        }
+    });
+    
+    for (const auto& stripe : stripePoints) {
+        candidates.insert(candidates.end(), stripe.begin(), stripe.end());
+    }
+}
+
+void cornerHarrisAt(const cv::Mat& src, const std::vector<cv::Point>& points,
+                    std::vector<float>& responses, int blockSize, int ksize, double k) {
+    CV_Assert(src.channels() == 1 && (src.depth() == CV_8U || src.depth() == CV_32F));
+    CV_Assert(blockSize > 0);
+    responses.resize(points.size());
+    if (points.empty()) return;
+    
+    cv::Mat sobelX, sobelY;
+    createSobelKernels(ksize, sobelX, sobelY);
+    cv::Mat window = createGaussianWindow(blockSize);
+    
+    // Same scaling as cornerHarrisResponse: 8-bit input is normalized to [0,1]
+    const bool is8U = src.depth() == CV_8U;
+    const float scale = is8U ? 1.0f / 255.0f : 1.0f;
+    const int kr = sobelX.rows / 2;
+    // Window offsets [-anchor, blockSize - anchor), as filter2D's default anchor
+    // places the blockSize x blockSize kernel (one tap fewer after the center
+    // when blockSize is even)
+    const int anchor = blockSize / 2;
+    const float* kx = sobelX.ptr<float>();
+    const float* ky = sobelY.ptr<float>();
+    const float* w = window.ptr<float>();
+    
+    auto pixel = [&](int x, int y) {
+        return is8U ? src.ptr<uchar>(y)[x] * scale : src.ptr<float>(y)[x];
+    };
+    
+    int numPoints = static_cast<int>(points.size());
+    parallelFor(cv::Range(0, numPoints), [&](const cv::Range& range) {
+        for (int i = range.start; i < range.end; i++) {
+            const cv::Point& p = points[i];
+            float sxx = 0, syy = 0, sxy = 0;
+            
+            // Window pixels and their Sobel taps both use the BORDER_REFLECT_101
+            // rule of filter2D, so border points match the dense response
+            for (int v = -anchor; v < blockSize - anchor; v++) {
+                int qy = cv::borderInterpolate(p.y + v, src.rows, cv::BORDER_REFLECT_101);
+                for (int u = -anchor; u < blockSize - anchor; u++) {
+                    int qx = cv::borderInterpolate(p.x + u, src.cols, cv::BORDER_REFLECT_101);
+                    
+                    float ix = 0, iy = 0;
+                    for (int j = -kr; j <= kr; j++) {
+                        int sy = cv::borderInterpolate(qy + j, src.rows, cv::BORDER_REFLECT_101);
+                        const float* kxRow = kx + (j + kr) * sobelX.cols + kr;
+                        const float* kyRow = ky + (j + kr) * sobelY.cols + kr;
+                        for (int m = -kr; m <= kr; m++) {
+                            int sx = cv::borderInterpolate(qx + m, src.cols, cv::BORDER_REFLECT_101);
+                            float val = pixel(sx, sy);
+                            ix += kxRow[m] * val;
+                            iy += kyRow[m] * val;
+                        }
+                    }
+                    
+                    float weight = w[(v + anchor) * blockSize + (u + anchor)];
+                    sxx += weight * ix * ix;
+                    syy += weight * iy * iy;
+                    sxy += weight * ix * iy;
+                }
+            }
+            
+            float det = sxx * syy - sxy * sxy;
+            float trace = sxx + syy;
+            responses[i] = static_cast<float>(det - k * trace * trace);
+        }
+    }, numPoints / 128.0);
+}
+
+// Non-maximum suppression among sparse points (3x3 neighborhood, row-major input).
+// Points absent from the list count as non-competing.
+static void suppressSparseNonMax(const std::vector<cv::Point>& points,
+                                 const std::vector<float>& responses, int rows,
+                                 float threshold, float size,
+                                 std::vector<cv::KeyPoint>& keypoints) {
+    // Row index: points of row y are points[rowStart[y] .. rowStart[y + 1])
+    std::vector<int> rowStart(rows + 1, 0);
+    for (const auto& p : points) rowStart[p.y + 1]++;
+    for (int y = 0; y < rows; y++) rowStart[y + 1] += rowStart[y];
+    
+    int numPoints = static_cast<int>(points.size());
+    std::vector<uchar> keep(numPoints, 0);
+    
+    parallelFor(cv::Range(0, numPoints), [&](const cv::Range& range) {
+        for (int i = range.start; i < range.end; i++) {
+            float v = responses[i];
+            if (v <= threshold) continue;
+            
+            const cv::Point& p = points[i];
+            bool isMax = true;
+            for (int ny = std::max(p.y - 1, 0); ny <= std::min(p.y + 1, rows - 1) && isMax; ny++) {
+                auto first = points.begin() + rowStart[ny];
+                auto last = points.begin() + rowStart[ny + 1];
+                auto it = std::lower_bound(first, last, p.x - 1,
+                    [](const cv::Point& a, int x) { return a.x < x; });
+                
+                for (; it != last && it->x <= p.x + 1; ++it) {
+                    int j = static_cast<int>(it - points.begin());
+                    if (j == i) continue;
+                    // Ties go to the earlier point in scan order
+                    if (responses[j] > v || (responses[j] == v && j < i)) {
+                        isMax = false;
+                        break;
+                    }
+                }
+            }
+            keep[i] = isMax;
+        }
+    });
+    
+    keypoints.clear();
+    for (int i = 0; i < numPoints; i++) {
+        if (keep[i]) {
+            keypoints.push_back(cv::KeyPoint(cv::Point2f(static_cast<float>(points[i].x),
+                                                         static_cast<float>(points[i].y)),
+                                             size, -1, responses[i]));
+        }
     }
+}
+
+void cornerHarrisFAST(const cv::Mat& src, std::vector<cv::KeyPoint>& keypoints,
+                      const FastHarrisParams& params) {
+    CUSTOM_CV_TRACE_SCOPE("cornerHarrisFAST");
+    CV_Assert(params.blockSize > 0);
+    keypoints.clear();
+    
+    if (src.empty()) {
+        CV_LOG_DEBUG(NULL, "custom_cv::cornerHarrisFAST: input image is empty");
+        return;
+    }
+    
+    // Step 1: Cheap segment test over the whole frame
+    std::vector<cv::Point> candidates;
+    detectFASTCandidates(src, candidates, params.fastThreshold, params.arcLength);
+    if (candidates.empty()) return;
+    
+    // Step 2: Harris response at the candidates only
+    std::vector<float> responses;
+    cornerHarrisAt(src, candidates, responses, params.blockSize, params.ksize, params.k);
     
-    std::cout << "Harris corner detection completed. Filtered response range: [" 
-              << "min=" << minVal << ", max=" << maxVal << "]" << std::endl;
+    // Step 3: Relative threshold and non-maximum suppression among candidates
+    float maxResponse = *std::max_element(responses.begin(), responses.end());
+    if (maxResponse <= 0) return;
+    
+    suppressSparseNonMax(candidates, responses, src.rows,
+                         static_cast<float>(maxResponse * params.threshold),
+                         static_cast<float>(params.blockSize), keypoints);
+}
+
+void cornerHarrisROI(const cv::Mat& src, const std::vector<cv::Rect>& rois,
+                     std::vector<cv::KeyPoint>& keypoints, int blockSize,
+                     int ksize, double k, double threshold) {
+    keypoints.clear();
+    
+    if (src.empty()) {
+        CV_LOG_DEBUG(NULL, "custom_cv::cornerHarrisROI: input image is empty");
+        return;
+    }
+    
+    // Pixels closer than this to a crop edge see reflected instead of real
+    // neighbors; one extra pixel lets the 3x3 maximum test see real values too
+    const int halo = sobelRadius(ksize) + blockSize / 2 + 1;
+    const cv::Rect imageRect(0, 0, src.cols, src.rows);
+    
+    FrameArena::Scope frame;
+    std::vector<cv::Rect> regions, crops;
+    std::vector<cv::Mat> cropResponses;
+    HarrisWorkspace ws;
+    useFrameArena(ws);
+    double maxResponse = 0;
+    
+    // Step 1: Dense response on every ROI plus its halo
+    for (const auto& roi : rois) {
+        cv::Rect region = roi & imageRect;
+        if (region.empty()) continue;
+        
+        cv::Rect crop(region.x - halo, region.y - halo,
+                      region.width + 2 * halo, region.height + 2 * halo);
+        crop &= imageRect;
+        
+        cv::Mat response = FrameArena::mat();
+        cornerHarrisResponse(src(crop), response, blockSize, ksize, k, ws);
+        
+        // Only the ROI part is trusted for the relative threshold
+        double minVal, maxVal;
+        cv::minMaxLoc(response(cv::Rect(region.x - crop.x, region.y - crop.y,
+                                        region.width, region.height)), &minVal, &maxVal);
+        maxResponse = std::max(maxResponse, maxVal);
+        
+        regions.push_back(region);
+        crops.push_back(crop);
+        cropResponses.push_back(response);
+    }
+    if (maxResponse <= 0) return;
+    
+    // Step 2: Local maxima that fall inside their ROI
+    float absThreshold = static_cast<float>(maxResponse * threshold);
+    std::vector<cv::Point> maxima;
+    
+    for (size_t i = 0; i < regions.size(); i++) {
+        findLocalMaxima(cropResponses[i], maxima, absThreshold);
+        
+        for (const auto& m : maxima) {
+            cv::Point p(m.x + crops[i].x, m.y + crops[i].y);
+            if (!regions[i].contains(p)) continue;
+            
+            keypoints.push_back(cv::KeyPoint(cv::Point2f(static_cast<float>(p.x),
+                                                         static_cast<float>(p.y)),
+                                             static_cast<float>(blockSize), -1,
+                                             cropResponses[i].at<float>(m)));
+        }
+    }
+    
+    // Overlapping ROIs report a shared corner only once
+    if (regions.size() > 1) {
+        auto rowMajor = [](const cv::KeyPoint& a, const cv::KeyPoint& b) {
+            return a.pt.y < b.pt.y || (a.pt.y == b.pt.y && a.pt.x < b.pt.x);
+        };
+        auto samePixel = [](const cv::KeyPoint& a, const cv::KeyPoint& b) {
+            return a.pt.x == b.pt.x && a.pt.y == b.pt.y;
+        };
+        std::sort(keypoints.begin(), keypoints.end(), rowMajor);
+        keypoints.erase(std::unique(keypoints.begin(), keypoints.end(), samePixel), keypoints.end());
+    }
+}
+
+// Row index after the BORDER_REFLECT_101 rule; height < 0 means the image
+// height is not known yet, which only ever happens at the top border
+static int reflectRow(int i, int height) {
+    if (height < 0) return i < 0 ? -i : i;
+    return cv::borderInterpolate(i, height, cv::BORDER_REFLECT_101);
+}
+
+StreamingHarris::StreamingHarris(int width, int blockSize, int ksize, double k, float threshold)
+    : width(width), blockSize(blockSize), k(k), threshold(threshold) {
+    CV_Assert(width > 0 && blockSize > 0 && blockSize % 2 == 1);
+    
+    createSobelKernels(ksize, sobelX, sobelY);
+    window1D = cv::getGaussianKernel(blockSize, -1, CV_32F);
+    kr = sobelX.rows / 2;
+    br = blockSize / 2;
+    
+    srcRing.create(2 * kr + 1, width + 2 * kr, CV_32F);
+    for (int c = 0; c < 3; c++) {
+        prodRing[c].create(blockSize, width, CV_32F);
+    }
+    respRing.create(3, width, CV_32F);
+    scratch.create(3, width + 2 * br, CV_32F);
+    reset();
+}
+
+void StreamingHarris::reset() {
+    rowsIn = 0;
+    derivRows = 0;
+    respRows = 0;
+    nmsRow = 0;
+}
+
+void StreamingHarris::pushRow(const cv::Mat& row, std::vector<cv::KeyPoint>& corners) {
+    CV_Assert(row.rows == 1 && row.cols == width && row.channels() == 1 &&
+              (row.depth() == CV_8U || row.depth() == CV_32F));
+    if (row.depth() == CV_8U) {
+        storeRow(row.ptr<uchar>(), nullptr);
+    } else {
+        storeRow(nullptr, row.ptr<float>());
+    }
+    advance(-1, corners);
+}
+
+void StreamingHarris::pushRow(const uchar* row, std::vector<cv::KeyPoint>& corners) {
+    storeRow(row, nullptr);
+    advance(-1, corners);
+}
+
+void StreamingHarris::finish(std::vector<cv::KeyPoint>& corners) {
+    if (rowsIn > 0) {
+        advance(rowsIn, corners);
+    }
+    reset();
+}
+
+void StreamingHarris::storeRow(const uchar* row8u, const float* row32f) {
+    // Keep the row reflect-padded so the Sobel taps need no bounds checks
+    float* dst = srcRing.ptr<float>(rowsIn % srcRing.rows);
+    for (int x = -kr; x < width + kr; x++) {
+        int sx = cv::borderInterpolate(x, width, cv::BORDER_REFLECT_101);
+        dst[x + kr] = row8u ? row8u[sx] * (1.0f / 255.0f) : row32f[sx];
+    }
+    rowsIn++;
+}
+
+void StreamingHarris::advance(int height, std::vector<cv::KeyPoint>& corners) {
+    // Downstream stages run first so every ring slot is consumed before it is overwritten
+    while (true) {
+        // Row r is tested once response row r + 1 exists; at the end of the image
+        // the last rows still need their response rows before they are suppressed
+        int nmsLimit = height < 0 ? respRows - 1 : std::min(height - 1, respRows - 1);
+        if (nmsRow < nmsLimit) {
+            if (nmsRow >= 1) emitRow(nmsRow, corners);
+            nmsRow++;
+            continue;
+        }
+        
+        bool windowReady = height < 0 ? respRows + br < derivRows
+                                      : respRows < height && (respRows + br < derivRows || derivRows == height);
+        if (windowReady) {
+            computeResponseRow(respRows, height);
+            respRows++;
+            continue;
+        }
+        
+        bool derivReady = height < 0 ? derivRows + kr < rowsIn : derivRows < height;
+        if (derivReady) {
+            computeProductRow(derivRows, height);
+            derivRows++;
+            continue;
+        }
+        break;
+    }
+}
+
+void StreamingHarris::computeProductRow(int d, int height) {
+    const int ks = sobelX.cols;
+    const float* kx = sobelX.ptr<float>();
+    const float* ky = sobelY.ptr<float>();
+    const float* g = window1D.ptr<float>();
+    
+    const float* src[7];
+    for (int j = 0; j < ks; j++) {
+        src[j] = srcRing.ptr<float>(reflectRow(d + j - kr, height) % srcRing.rows);
+    }
+    
+    // Derivatives and their products, reflect-padded by the window radius
+    float* pxx = scratch.ptr<float>(0) + br;
+    float* pyy = scratch.ptr<float>(1) + br;
+    float* pxy = scratch.ptr<float>(2) + br;
+    for (int x = 0; x < width; x++) {
+        float ix = 0, iy = 0;
+        for (int j = 0; j < ks; j++) {
+            const float* srcRow = src[j] + x;
+            for (int m = 0; m < ks; m++) {
+                ix += kx[j * ks + m] * srcRow[m];
+                iy += ky[j * ks + m] * srcRow[m];
+            }
+        }
+        pxx[x] = ix * ix;
+        pyy[x] = iy * iy;
+        pxy[x] = ix * iy;
+    }
+    for (int x = -br; x < 0; x++) {
+        int sx = cv::borderInterpolate(x, width, cv::BORDER_REFLECT_101);
+        pxx[x] = pxx[sx]; pyy[x] = pyy[sx]; pxy[x] = pxy[sx];
+    }
+    for (int x = width; x < width + br; x++) {
+        int sx = cv::borderInterpolate(x, width, cv::BORDER_REFLECT_101);
+        pxx[x] = pxx[sx]; pyy[x] = pyy[sx]; pxy[x] = pxy[sx];
+    }
+    
+    // Horizontal half of the separable Gaussian window
+    for (int c = 0; c < 3; c++) {
+        const float* p = scratch.ptr<float>(c);
+        float* out = prodRing[c].ptr<float>(d % blockSize);
+        for (int x = 0; x < width; x++) {
+            float sum = 0;
+            for (int u = 0; u < blockSize; u++) {
+                sum += g[u] * p[x + u];
+            }
+            out[x] = sum;
+        }
+    }
+}
+
+void StreamingHarris::computeResponseRow(int w, int height) {
+    const float* g = window1D.ptr<float>();
+    const float* xx[32];
+    const float* yy[32];
+    const float* xy[32];
+    CV_Assert(blockSize <= 32);
+    
+    for (int j = 0; j < blockSize; j++) {
+        int slot = reflectRow(w + j - br, height) % blockSize;
+        xx[j] = prodRing[0].ptr<float>(slot);
+        yy[j] = prodRing[1].ptr<float>(slot);
+        xy[j] = prodRing[2].ptr<float>(slot);
+    }
+    
+    // Vertical half of the window, then the Harris response
+    float* resp = respRing.ptr<float>(w % 3);
+    for (int x = 0; x < width; x++) {
+        float sxx = 0, syy = 0, sxy = 0;
+        for (int j = 0; j < blockSize; j++) {
+            sxx += g[j] * xx[j][x];
+            syy += g[j] * yy[j][x];
+            sxy += g[j] * xy[j][x];
+        }
+        float det = sxx * syy - sxy * sxy;
+        float trace = sxx + syy;
+        resp[x] = static_cast<float>(det - k * trace * trace);
+    }
+}
+
+void StreamingHarris::emitRow(int r, std::vector<cv::KeyPoint>& corners) {
+    const float* rows[3] = {
+        respRing.ptr<float>((r - 1) % 3),
+        respRing.ptr<float>(r % 3),
+        respRing.ptr<float>((r + 1) % 3)
+    };
+    
+    // Same maximum rule as findLocalMaxima with radius 1
+    for (int x = 1; x < width - 1; x++) {
+        float v = rows[1][x];
+        if (v <= threshold) continue;
+        
+        bool isMax = true;
+        for (int dy = -1; dy <= 1 && isMax; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                if (dy == 0 && dx == 0) continue;
+                float n = rows[dy + 1][x + dx];
+                bool before = dy < 0 || (dy == 0 && dx < 0);
+                if (n > v || (n == v && before)) {
+                    isMax = false;
+                    break;
+                }
+            }
+        }
+        
+        if (isMax) {
+            corners.push_back(cv::KeyPoint(cv::Point2f(static_cast<float>(x), static_cast<float>(r)),
+                                           static_cast<float>(blockSize), -1, v));
+        }
+    }
+}
+
+VideoHarris::VideoHarris(int tileSize, int blockSize, int ksize, double k,
+                         float threshold, double changeThreshold)
+    : tileSize(tileSize), blockSize(blockSize), ksize(ksize), k(k),
+      threshold(threshold), changeThreshold(changeThreshold),
+      tilesX(0), tilesY(0), lastDirtyTiles(0) {
+    CV_Assert(tileSize > 0);
+    // Sobel radius + window radius
+    halo = sobelRadius(ksize) + blockSize / 2;
+}
+
+void VideoHarris::reset() {
+    prevFrame.release();
+    tilesX = tilesY = 0;
+    lastDirtyTiles = 0;
+}
+
+cv::Rect VideoHarris::tileRect(int index) const {
+    int x = (index % tilesX) * tileSize;
+    int y = (index / tilesX) * tileSize;
+    return cv::Rect(x, y, std::min(tileSize, prevFrame.cols - x),
+                    std::min(tileSize, prevFrame.rows - y));
+}
+
+void VideoHarris::detect(const cv::Mat& frame, std::vector<cv::KeyPoint>& keypoints) {
+    CUSTOM_CV_TRACE_SCOPE("VideoHarris");
+    keypoints.clear();
+    
+    if (frame.empty()) {
+        CV_LOG_DEBUG(NULL, "custom_cv::VideoHarris::detect: input image is empty");
+        return;
+    }
+    CV_Assert(frame.type() == CV_8UC1);
+    
+    const cv::Rect frameRect(0, 0, frame.cols, frame.rows);
+    bool firstFrame = prevFrame.empty() || prevFrame.size() != frame.size();
+    
+    if (firstFrame) {
+        frame.copyTo(prevFrame);
+        responseMap.create(frame.size(), CV_32F);
+        tilesX = (frame.cols + tileSize - 1) / tileSize;
+        tilesY = (frame.rows + tileSize - 1) / tileSize;
+        dirty.assign(tilesX * tilesY, 1);
+        tileMaxima.assign(tilesX * tilesY, std::vector<cv::Point>());
+        tileCorners.assign(tilesX * tilesY, std::vector<cv::KeyPoint>());
+    }
+    const int numTiles = tilesX * tilesY;
+    
+    // Step 1: Change detection (mean absolute difference per tile)
+    if (!firstFrame) {
+        parallelFor(cv::Range(0, numTiles), [&](const cv::Range& range) {
+            for (int i = range.start; i < range.end; i++) {
+                cv::Rect r = tileRect(i);
+                double sad = cv::norm(frame(r), prevFrame(r), cv::NORM_L1);
+                dirty[i] = sad > changeThreshold * r.area();
+                // Clean tiles keep their reference so slow drift still accumulates
+                if (dirty[i]) {
+                    frame(r).copyTo(prevFrame(r));
+                }
+            }
+        });
+    }
+    
+    // Step 2: New response for every dirty tile plus the halo it influences.
+    // The crop carries one more halo so the patched pixels see real neighbors.
+    nmsDirty.assign(numTiles, 0);
+    lastDirtyTiles = 0;
+    
+    for (int i = 0; i < numTiles; i++) {
+        if (!dirty[i]) continue;
+        lastDirtyTiles++;
+        
+        cv::Rect tile = tileRect(i);
+        cv::Rect region(tile.x - halo, tile.y - halo, tile.width + 2 * halo, tile.height + 2 * halo);
+        region &= frameRect;
+        cv::Rect crop(region.x - halo, region.y - halo, region.width + 2 * halo, region.height + 2 * halo);
+        crop &= frameRect;
+        
+        cornerHarrisResponse(prevFrame(crop), cropResponse, blockSize, ksize, k, ws);
+        cropResponse(cv::Rect(region.x - crop.x, region.y - crop.y, region.width, region.height))
+            .copyTo(responseMap(region));
+        
+        // Every tile whose 3x3 maximum test reads a patched pixel is stale
+        int tx0 = std::max(0, (region.x - 1) / tileSize);
+        int ty0 = std::max(0, (region.y - 1) / tileSize);
+        int tx1 = std::min(tilesX - 1, (region.x + region.width) / tileSize);
+        int ty1 = std::min(tilesY - 1, (region.y + region.height) / tileSize);
+        for (int ty = ty0; ty <= ty1; ty++) {
+            for (int tx = tx0; tx <= tx1; tx++) {
+                nmsDirty[ty * tilesX + tx] = 1;
+            }
+        }
+    }
+    
+    // Step 3: Maximum test on the stale tiles only (image border pixels are
+    // skipped, as in findLocalMaxima)
+    const cv::Rect inner(1, 1, frame.cols - 2, frame.rows - 2);
+    parallelFor(cv::Range(0, numTiles), [&](const cv::Range& range) {
+        for (int i = range.start; i < range.end; i++) {
+            if (!nmsDirty[i]) continue;
+            
+            std::vector<cv::Point>& maxima = tileMaxima[i];
+            std::vector<cv::KeyPoint>& corners = tileCorners[i];
+            maxima.clear();
+            corners.clear();
+            
+            cv::Rect r = tileRect(i) & inner;
+            if (r.empty()) continue;
+            dispatch::localMaxima(responseMap, r, threshold, 1, maxima);
+            
+            for (const auto& p : maxima) {
+                corners.push_back(cv::KeyPoint(cv::Point2f(static_cast<float>(p.x),
+                                                           static_cast<float>(p.y)),
+                                               static_cast<float>(blockSize), -1,
+                                               responseMap.at<float>(p)));
+            }
+        }
+    });
+    
+    // Step 4: Clean tiles contribute their cached corners
+    for (const auto& corners : tileCorners) {
+        keypoints.insert(keypoints.end(), corners.begin(), corners.end());
+    }
+}
+
+HarrisLaplaceDetector::HarrisLaplaceDetector(int numLevels, double scaleFactor,
+                                             int blockSize, int ksize, double k,
+                                             double threshold)
+    : numLevels(std::max(1, numLevels)), scaleFactor(scaleFactor),
+      blockSize(blockSize), ksize(ksize), k(k), threshold(threshold) {
+    CV_Assert(scaleFactor > 1.0);
+}
+
+void HarrisLaplaceDetector::allocate(const cv::Size& size) {
+    levelScales.clear();
+    pyramid.clear();
+    blurred.clear();
+    laplacians.clear();
+    responses.clear();
+    
+    // Stop once a level is too small to hold a single Harris window
+    const int minSide = 2 * (blockSize + ksize);
+    cv::Size levelSize = size;
+    double scale = 1.0;
+    
+    for (int l = 0; l < numLevels; l++) {
+        if (levelSize.width < minSide || levelSize.height < minSide) break;
+        
+        levelScales.push_back(scale);
+        pyramid.push_back(cv::Mat(levelSize, CV_32F));
+        blurred.push_back(cv::Mat(levelSize, CV_32F));
+        laplacians.push_back(cv::Mat(levelSize, CV_32F));
+        responses.push_back(cv::Mat(levelSize, CV_32F));
+        
+        scale *= scaleFactor;
+        levelSize = cv::Size(cvRound(size.width / scale), cvRound(size.height / scale));
+    }
+    
+    // Workspace planes are created on the first detect() and reused afterwards
+    workspaces.assign(pyramid.size(), HarrisWorkspace());
+    levelMaxima.assign(pyramid.size(), std::vector<cv::Point>());
+    allocatedSize = size;
+}
+
+void HarrisLaplaceDetector::detect(const cv::Mat& src, std::vector<cv::KeyPoint>& keypoints) {
+    CUSTOM_CV_TRACE_SCOPE("HarrisLaplaceDetector");
+    keypoints.clear();
+    
+    if (src.empty()) {
+        CV_LOG_DEBUG(NULL, "custom_cv::HarrisLaplaceDetector::detect: input image is empty");
+        return;
+    }
+    CV_Assert(src.channels() == 1);
+    
+    if (src.size() != allocatedSize) {
+        allocate(src.size());
+    }
+    int levels = static_cast<int>(pyramid.size());
+    if (levels == 0) return;
+    
+    // Step 1: Gaussian pyramid. The smoothed level is both the anti-aliased
+    // source of the next level and the input of the LoG below
+    if (src.type() != CV_32F) {
+        src.convertTo(pyramid[0], CV_32F, 1.0/255.0);
+    } else {
+        src.copyTo(pyramid[0]);
+    }
+    double sigma = std::sqrt(scaleFactor * scaleFactor - 1.0);
+    for (int l = 0; l < levels; l++) {
+        cv::GaussianBlur(pyramid[l], blurred[l], cv::Size(), sigma, sigma);
+        if (l + 1 < levels) {
+            cv::resize(blurred[l], pyramid[l + 1], pyramid[l + 1].size(), 0, 0, cv::INTER_LINEAR);
+        }
+    }
+    
+    // Step 2: Harris response and Laplacian on every level.
+    // Derivatives are taken in level pixels, which already makes both
+    // measures scale-normalized with respect to the input image
+    double maxResponse = 0;
+    for (int l = 0; l < levels; l++) {
+        cornerHarrisResponse(pyramid[l], responses[l], blockSize, ksize, k, workspaces[l]);
+        cv::Laplacian(blurred[l], laplacians[l], CV_32F, 3);
+        
+        double minVal, maxVal;
+        cv::minMaxLoc(responses[l], &minVal, &maxVal);
+        maxResponse = std::max(maxResponse, maxVal);
+    }
+    if (maxResponse <= 0) return;
+    
+    // Step 3: Spatial maxima of the Harris response on every level
+    float absThreshold = static_cast<float>(maxResponse * threshold);
+    for (int l = 0; l < levels; l++) {
+        findLocalMaxima(responses[l], levelMaxima[l], absThreshold);
+    }
+    
+    // Step 4: Characteristic scale selection - keep a corner only where |LoG|
+    // is not exceeded by the neighboring levels at the same image position
+    auto laplacianAt = [&](int level, const cv::Point2f& inputPt) {
+        const cv::Mat& lap = laplacians[level];
+        double s = levelScales[level];
+        int x = cvRound((inputPt.x + 0.5) / s - 0.5);
+        int y = cvRound((inputPt.y + 0.5) / s - 0.5);
+        x = std::min(std::max(x, 0), lap.cols - 1);
+        y = std::min(std::max(y, 0), lap.rows - 1);
+        return std::abs(lap.at<float>(y, x));
+    };
+    
+    for (int l = 0; l < levels; l++) {
+        double s = levelScales[l];
+        
+        for (const auto& p : levelMaxima[l]) {
+            cv::Point2f inputPt(static_cast<float>((p.x + 0.5) * s - 0.5),
+                                static_cast<float>((p.y + 0.5) * s - 0.5));
+            float lap = std::abs(laplacians[l].at<float>(p.y, p.x));
+            
+            if (lap <= 0) continue;
+            if (l > 0 && laplacianAt(l - 1, inputPt) > lap) continue;
+            if (l + 1 < levels && laplacianAt(l + 1, inputPt) > lap) continue;
+            
+            keypoints.push_back(cv::KeyPoint(inputPt, static_cast<float>(blockSize * s), -1,
+                                             responses[l].at<float>(p.y, p.x), l));
+        }
+    }
+}
+
+// Direction bins of cv::Canny: tan(22.5 deg) in fixed point with CANNY_SHIFT
+// fraction bits, tan(67.5 deg) = tan(22.5 deg) + 2
+static const int CANNY_SHIFT = 15;
+static const double CANNY_TG22 = static_cast<int>(0.4142135623730950488016887242097 * (1 << CANNY_SHIFT) + 0.5);
+
+static void computeGradientMagnitude(const cv::Mat& Ix, const cv::Mat& Iy, cv::Mat& magnitude) {
+    magnitude.create(Ix.size(), CV_32F);
+    
+    parallelFor(cv::Range(0, Ix.rows), [&](const cv::Range& range) {
+        for (int y = range.start; y < range.end; y++) {
+            const float* gxRow = Ix.ptr<float>(y);
+            const float* gyRow = Iy.ptr<float>(y);
+            float* mRow = magnitude.ptr<float>(y);
+            
+            for (int x = 0; x < Ix.cols; x++) {
+                mRow[x] = std::abs(gxRow[x]) + std::abs(gyRow[x]);
+            }
+        }
+    });
+}
+
+// Non-maximum suppression along the gradient direction quantized to 4 bins,
+// with cv::Canny's comparisons: the bin boundaries are strict fixed-point
+// tests, and a pixel must be greater than its neighbor on one side and at
+// least equal on the other (greater than both on the diagonals), so exactly
+// one pixel of a plateau survives. On 16-bit gradients the result equals
+// cv::Canny's; the double arithmetic below is exact for those values.
+// marks: 0 = no edge, 1 = weak (low < m <= high), 2 = strong (m > high).
+// The outermost pixels are never edges (cv::Canny tests them against zero
+// padding), so hysteresis needs no bounds checks.
+template<typename T>
+static void suppressNonMaxima(const cv::Mat& Ix, const cv::Mat& Iy, const cv::Mat& magnitude,
+                              float low, float high, cv::Mat& marks) {
+    marks.create(Ix.size(), CV_8U);
+    if (marks.rows < 3 || marks.cols < 3) {
+        marks.setTo(0);
+        return;
+    }
+    marks.row(0).setTo(0);
+    marks.row(marks.rows - 1).setTo(0);
+    
+    parallelFor(cv::Range(1, marks.rows - 1), [&](const cv::Range& range) {
+        for (int y = range.start; y < range.end; y++) {
+            const T* gxRow = Ix.ptr<T>(y);
+            const T* gyRow = Iy.ptr<T>(y);
+            const T* up = magnitude.ptr<T>(y - 1);
+            const T* row = magnitude.ptr<T>(y);
+            const T* down = magnitude.ptr<T>(y + 1);
+            uchar* mRow = marks.ptr<uchar>(y);
+            
+            mRow[0] = 0;
+            mRow[marks.cols - 1] = 0;
+            
+            for (int x = 1; x < marks.cols - 1; x++) {
+                float m = row[x];
+                uchar mark = 0;
+                
+                if (m > low) {
+                    double gx = static_cast<double>(gxRow[x]);
+                    double gy = static_cast<double>(gyRow[x]);
+                    double ax = std::abs(gx);
+                    double ay = std::abs(gy) * (1 << CANNY_SHIFT);
+                    double tg22x = ax * CANNY_TG22;
+                    double tg67x = tg22x + ax * (2 << CANNY_SHIFT);
+                    bool isMax;
+                    
+                    if (ay < tg22x) {                   // Horizontal gradient
+                        isMax = m > row[x - 1] && m >= row[x + 1];
+                    } else if (ay > tg67x) {            // Vertical gradient
+                        isMax = m > up[x] && m >= down[x];
+                    } else {                            // Diagonal: down-right if the signs agree
+                        int s = (gx < 0) != (gy < 0) ? -1 : 1;
+                        isMax = m > up[x - s] && m > down[x + s];
+                    }
+                    
+                    if (isMax) {
+                        mark = m > high ? 2 : 1;
+                    }
+                }
+                mRow[x] = mark;
+            }
+        }
+    });
+}
+
+// Hysteresis with one worklist per stripe. Stripes seed from their own strong
+// pixels and may follow weak chains into other stripes; promotion 1 -> 255 is
+// a compare-exchange, so every weak pixel is claimed by exactly one thread.
+static void traceHysteresisParallel(cv::Mat& marks, std::vector<std::vector<ptrdiff_t>>& stacks) {
+    static_assert(sizeof(std::atomic<uchar>) == sizeof(uchar), "atomic<uchar> must alias uchar");
+    CV_Assert(marks.isContinuous());
+    
+    int innerRows = marks.rows - 2;
+    if (innerRows <= 0 || marks.cols < 3) {
+        return;
+    }
+    
+    std::atomic<uchar>* base = reinterpret_cast<std::atomic<uchar>*>(marks.data);
+    const ptrdiff_t step = static_cast<ptrdiff_t>(marks.step);
+    const ptrdiff_t offsets[8] = { -step - 1, -step, -step + 1, -1, 1, step - 1, step, step + 1 };
+    
+    int numStripes = std::max(1, std::min(innerRows, cv::getNumThreads() * 4));
+    if (static_cast<int>(stacks.size()) < numStripes) {
+        stacks.resize(numStripes);
+    }
+    
+    parallelFor(cv::Range(0, numStripes), [&](const cv::Range& range) {
+        for (int s = range.start; s < range.end; s++) {
+            int yBegin = 1 + innerRows * s / numStripes;
+            int yEnd = 1 + innerRows * (s + 1) / numStripes;
+            std::vector<ptrdiff_t>& stack = stacks[s];
+            stack.clear();
+            
+            for (int y = yBegin; y < yEnd; y++) {
+                for (int x = 1; x < marks.cols - 1; x++) {
+                    ptrdiff_t idx = y * step + x;
+                    // Strong pixels are only ever written by their own stripe
+                    if (base[idx].load(std::memory_order_relaxed) == 2) {
+                        base[idx].store(255, std::memory_order_relaxed);
+                        stack.push_back(idx);
+                    }
+                }
+            }
+            
+            while (!stack.empty()) {
+                ptrdiff_t idx = stack.back();
+                stack.pop_back();
+                
+                for (ptrdiff_t offset : offsets) {
+                    uchar expected = 1;
+                    if (base[idx + offset].compare_exchange_strong(expected, 255,
+                                                                   std::memory_order_relaxed)) {
+                        stack.push_back(idx + offset);
+                    }
+                }
+            }
+        }
+    });
+}
+
+// Final hysteresis pass: weak pixels never reached from a strong one are dropped
+static void keepTracedEdges(cv::Mat& marks) {
+    parallelFor(cv::Range(0, marks.rows), [&](const cv::Range& range) {
+        for (int y = range.start; y < range.end; y++) {
+            uchar* row = marks.ptr<uchar>(y);
+            for (int x = 0; x < marks.cols; x++) {
+                row[x] = row[x] == 255 ? 255 : 0;
+            }
+        }
+    });
+}
+
+FrameAnalyzer::FrameAnalyzer(const FrameAnalyzerParams& params)
+    : params(params) {
+}
+
+void FrameAnalyzer::analyze(const cv::Mat& src, cv::Mat& edges,
+                            std::vector<cv::Vec2f>& lines, cv::Mat& harris) {
+    CUSTOM_CV_TRACE_SCOPE("FrameAnalyzer");
+    lines.clear();
+    
+    if (src.empty()) {
+        CV_LOG_DEBUG(NULL, "custom_cv::FrameAnalyzer::analyze: input image is empty");
+        return;
+    }
+    
+    // Step 1: Shared derivatives (same normalization and BORDER_REFLECT_101
+    // padding as cornerHarris; cv::Canny replicates the border instead)
+    double intensityScale = 1.0;
+    {
+        CUSTOM_CV_TRACE_SCOPE("convert+sobel");
+        if (src.type() != CV_32F) {
+            src.convertTo(ws.srcFloat, CV_32F, 1.0/255.0);
+            intensityScale = 1.0/255.0;
+        } else {
+            src.copyTo(ws.srcFloat);
+        }
+        computeSobelDerivatives(ws.srcFloat, ws.Ix, ws.Iy, params.ksize);
+    }
+    
+    // Step 2: Edge map from Ix/Iy. Thresholds are given in cv::Canny units,
+    // so undo the intensity and 5x5 kernel normalization applied above.
+    {
+        CUSTOM_CV_TRACE_SCOPE("edges");
+        double gradScale = intensityScale * sobelNormalization(params.ksize);
+        computeGradientMagnitude(ws.Ix, ws.Iy, magnitude);
+        suppressNonMaxima<float>(ws.Ix, ws.Iy, magnitude,
+                          static_cast<float>(params.cannyLow * gradScale),
+                          static_cast<float>(params.cannyHigh * gradScale), edges);
+        traceHysteresisParallel(edges, edgeStacks);
+        keepTracedEdges(edges);
+    }
+    
+    // Step 3: Lines
+    HoughLines(edges, lines, params.rho, params.theta, params.houghThreshold, hough);
+    
+    // Step 4: Harris structure tensor from the same Ix/Iy
+    {
+        CUSTOM_CV_TRACE_SCOPE("products+window+response");
+        if (!dispatch::harrisResponseFromGradients(ws.Ix, ws.Iy, harris, params.blockSize, params.k)) {
+            computeDerivativeProducts(ws.Ix, ws.Iy, ws.Ixx, ws.Iyy, ws.Ixy);
+            applyGaussianWeighting(ws.Ixx, ws.Iyy, ws.Ixy, params.blockSize);
+            computeHarrisResponse(ws.Ixx, ws.Iyy, ws.Ixy, harris, params.k);
+        }
+    }
+    
+    suppressWeakCorners(harris, ws.eroded, nullptr);
+}
+
+// 3x3 Sobel on 8-bit input with replicated borders (as cv::Canny), in 16-bit
+// integers: |d| <= 1020 and the L1 magnitude <= 2040 fit without overflow
+static void computeSobel3x3(const cv::Mat& src, cv::Mat& dx, cv::Mat& dy, cv::Mat& magnitude) {
+    dx.create(src.size(), CV_16S);
+    dy.create(src.size(), CV_16S);
+    magnitude.create(src.size(), CV_16S);
+    const int cols = src.cols;
+    
+    parallelFor(cv::Range(0, src.rows), [&](const cv::Range& range) {
+        for (int y = range.start; y < range.end; y++) {
+            const uchar* r0 = src.ptr<uchar>(std::max(y - 1, 0));
+            const uchar* r1 = src.ptr<uchar>(y);
+            const uchar* r2 = src.ptr<uchar>(std::min(y + 1, src.rows - 1));
+            short* gx = dx.ptr<short>(y);
+            short* gy = dy.ptr<short>(y);
+            short* mg = magnitude.ptr<short>(y);
+            
+            auto sobelAt = [&](int x) {
+                int xl = std::max(x - 1, 0);
+                int xr = std::min(x + 1, cols - 1);
+                int vx = (r0[xr] - r0[xl]) + 2 * (r1[xr] - r1[xl]) + (r2[xr] - r2[xl]);
+                int vy = (r2[xl] + 2 * r2[x] + r2[xr]) - (r0[xl] + 2 * r0[x] + r0[xr]);
+                gx[x] = static_cast<short>(vx);
+                gy[x] = static_cast<short>(vy);
+                mg[x] = static_cast<short>(std::abs(vx) + std::abs(vy));
+            };
+            
+            sobelAt(0);
+            int x = 1;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+            const int lanes = cv::VTraits<cv::v_int16>::vlanes();
+            for (; x <= cols - 1 - lanes; x += lanes) {
+                cv::v_int16 l0 = cv::v_reinterpret_as_s16(cv::vx_load_expand(r0 + x - 1));
+                cv::v_int16 c0 = cv::v_reinterpret_as_s16(cv::vx_load_expand(r0 + x));
+                cv::v_int16 p0 = cv::v_reinterpret_as_s16(cv::vx_load_expand(r0 + x + 1));
+                cv::v_int16 l1 = cv::v_reinterpret_as_s16(cv::vx_load_expand(r1 + x - 1));
+                cv::v_int16 p1 = cv::v_reinterpret_as_s16(cv::vx_load_expand(r1 + x + 1));
+                cv::v_int16 l2 = cv::v_reinterpret_as_s16(cv::vx_load_expand(r2 + x - 1));
+                cv::v_int16 c2 = cv::v_reinterpret_as_s16(cv::vx_load_expand(r2 + x));
+                cv::v_int16 p2 = cv::v_reinterpret_as_s16(cv::vx_load_expand(r2 + x + 1));
+                
+                cv::v_int16 d1 = cv::v_sub(p1, l1);
+                cv::v_int16 vx = cv::v_add(cv::v_add(cv::v_sub(p0, l0), cv::v_sub(p2, l2)),
+                                           cv::v_add(d1, d1));
+                cv::v_int16 s0 = cv::v_add(cv::v_add(l0, p0), cv::v_add(c0, c0));
+                cv::v_int16 s2 = cv::v_add(cv::v_add(l2, p2), cv::v_add(c2, c2));
+                cv::v_int16 vy = cv::v_sub(s2, s0);
+                cv::v_int16 m = cv::v_add(cv::v_reinterpret_as_s16(cv::v_abs(vx)),
+                                          cv::v_reinterpret_as_s16(cv::v_abs(vy)));
+                
+                cv::v_store(gx + x, vx);
+                cv::v_store(gy + x, vy);
+                cv::v_store(mg + x, m);
+            }
+#endif
+            for (; x < cols; x++) {
+                sobelAt(x);
+            }
+        }
+    });
+}
+
+// Gradients, non-maximum suppression and hysteresis; ws.marks ends up holding
+// 255 for edges, 1 for rejected weak pixels and 0 elsewhere
+static bool runCanny(const cv::Mat& src, double lowThreshold, double highThreshold,
+                     CannyWorkspace& ws, cv::Mat& marks) {
+    CUSTOM_CV_TRACE_SCOPE("Canny");
+    if (src.empty()) {
+        CV_LOG_DEBUG(NULL, "custom_cv::Canny: input image is empty");
+        return false;
+    }
+    CV_Assert(src.type() == CV_8UC1);
+    
+    if (lowThreshold > highThreshold) {
+        std::swap(lowThreshold, highThreshold);
+    }
+    
+    // Step 1: Sobel gradients and L1 magnitude (SIMD)
+    {
+        CUSTOM_CV_TRACE_SCOPE("sobel");
+        computeSobel3x3(src, ws.dx, ws.dy, ws.magnitude);
+    }
+    
+    // Step 2: Row-parallel non-maximum suppression (integer thresholds as cv::Canny)
+    {
+        CUSTOM_CV_TRACE_SCOPE("non-maximum suppression");
+        suppressNonMaxima<short>(ws.dx, ws.dy, ws.magnitude,
+                                 static_cast<float>(cvFloor(lowThreshold)),
+                                 static_cast<float>(cvFloor(highThreshold)), marks);
+    }
+    
+    // Step 3: Hysteresis
+    CUSTOM_CV_TRACE_SCOPE("hysteresis");
+    traceHysteresisParallel(marks, ws.stacks);
+    return true;
+}
+
+void Canny(const cv::Mat& src, cv::Mat& edges, double lowThreshold, double highThreshold) {
+    FrameArena::Scope frame;
+    CannyWorkspace ws;
+    useFrameArena(ws);
+    Canny(src, edges, lowThreshold, highThreshold, ws);
+}
+
+void Canny(const cv::Mat& src, cv::Mat& edges, double lowThreshold, double highThreshold,
+           CannyWorkspace& ws) {
+    if (!runCanny(src, lowThreshold, highThreshold, ws, edges)) {
+        return;
+    }
+    keepTracedEdges(edges);
+}
+
+void Canny(const cv::Mat& src, EdgeList& edges, double lowThreshold, double highThreshold) {
+    FrameArena::Scope frame;
+    CannyWorkspace ws;
+    useFrameArena(ws);
+    Canny(src, edges, lowThreshold, highThreshold, ws);
+}
+
+void Canny(const cv::Mat& src, EdgeList& edges, double lowThreshold, double highThreshold,
+           CannyWorkspace& ws) {
+    edges.clear();
+    if (!runCanny(src, lowThreshold, highThreshold, ws, ws.marks)) {
+        return;
+    }
+    edges.imageSize = src.size();
+    CUSTOM_CV_TRACE_SCOPE("edge list");
+    
+    // Step 4: Count edges per row, then fill the arrays in row-major order
+    const cv::Mat& marks = ws.marks;
+    ws.rowOffsets.assign(marks.rows + 1, 0);
+    
+    parallelFor(cv::Range(0, marks.rows), [&](const cv::Range& range) {
+        for (int y = range.start; y < range.end; y++) {
+            const uchar* row = marks.ptr<uchar>(y);
+            int count = 0;
+            for (int x = 0; x < marks.cols; x++) {
+                count += row[x] == 255;
+            }
+            ws.rowOffsets[y + 1] = count;
+        }
+    });
+    
+    for (int y = 0; y < marks.rows; y++) {
+        ws.rowOffsets[y + 1] += ws.rowOffsets[y];
+    }
+    
+    size_t total = static_cast<size_t>(ws.rowOffsets[marks.rows]);
+    edges.x.resize(total);
+    edges.y.resize(total);
+    edges.angle.resize(total);
+    edges.magnitude.resize(total);
+    
+    parallelFor(cv::Range(0, marks.rows), [&](const cv::Range& range) {
+        for (int y = range.start; y < range.end; y++) {
+            const uchar* row = marks.ptr<uchar>(y);
+            const short* gx = ws.dx.ptr<short>(y);
+            const short* gy = ws.dy.ptr<short>(y);
+            const short* mg = ws.magnitude.ptr<short>(y);
+            size_t i = static_cast<size_t>(ws.rowOffsets[y]);
+            
+            for (int x = 0; x < marks.cols; x++) {
+                if (row[x] != 255) continue;
+                edges.x[i] = x;
+                edges.y[i] = y;
+                edges.angle[i] = std::atan2(static_cast<float>(gy[x]), static_cast<float>(gx[x]));
+                edges.magnitude[i] = static_cast<float>(mg[x]);
+                i++;
+            }
+        }
+    });
 }
 
 }
\ No newline at end of file
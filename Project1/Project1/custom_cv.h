@@ -2,9 +2,27 @@
 #include <opencv2/opencv.hpp>
 #include <vector>
 #include <cmath>
+#include <cstdint>
 
 namespace custom_cv {
     
+    /**
+     * Per-call statistics of HoughLines (optional out-parameter)
+     */
+    struct HoughStats {
+        size_t edgePixels = 0;              // Edge pixels scanned (points that voted)
+        size_t votesCast = 0;               // Accumulator increments (edgePixels x angle bins)
+        cv::Size accumulatorSize;           // Angle bins x rho bins
+        size_t candidatePeaks = 0;          // 5x5 local maxima at or above the threshold
+        size_t rejectedDiagonal = 0;        // Peaks dropped by the horizontal/vertical filter
+        size_t suppressedDuplicates = 0;    // Peaks dropped as too similar to a kept line
+        size_t linesFound = 0;
+        int64_t collectNs = 0;              // Dense input only: edge pixel scan
+        int64_t voteNs = 0;
+        int64_t peakNs = 0;
+        int64_t filterNs = 0;               // Sorting and strict filtering
+    };
+    
     /**
      * Custom implementation of Hough Line Transform
      * Equivalent to cv::HoughLines function
@@ -14,9 +32,119 @@ namespace custom_cv {
      * @param rho Distance resolution of the accumulator in pixels
      * @param theta Angle resolution of the accumulator in radians
      * @param threshold Accumulator threshold parameter. Only those lines are returned that get enough votes (>threshold)
+     * @param stats Optional per-call statistics
      */
     void HoughLines(const cv::Mat& image, std::vector<cv::Vec2f>& lines, 
-                   double rho, double theta, int threshold);
+                   double rho, double theta, int threshold, HoughStats* stats = nullptr);
+    
+    /**
+     * Intermediate buffers of HoughLines.
+     * Passing the same workspace to repeated calls with the same image size and
+     * resolution keeps the accumulator and point lists from being reallocated.
+     */
+    struct HoughWorkspace {
+        std::vector<int> xs, ys;                // Edge points of the dense input
+        cv::Mat accumulator;                    // Votes, rho bins x angle bins (CV_32S)
+        std::vector<double> cosTable, sinTable;
+        std::vector<std::pair<int, std::pair<int, int>>> candidates;   // votes, (r, t)
+    };
+    
+    /**
+     * HoughLines variant that keeps its intermediates in a caller-owned workspace
+     */
+    void HoughLines(const cv::Mat& image, std::vector<cv::Vec2f>& lines,
+                    double rho, double theta, int threshold, HoughWorkspace& ws,
+                    HoughStats* stats = nullptr);
+    
+    /**
+     * Sparse edge list in structure-of-arrays layout, as produced by Canny.
+     * Entry i is the edge pixel (x[i], y[i]); points are in row-major order.
+     */
+    struct EdgeList {
+        cv::Size imageSize;             // Size of the source image
+        std::vector<int> x;
+        std::vector<int> y;
+        std::vector<float> angle;       // Gradient direction atan2(gy, gx) in radians
+        std::vector<float> magnitude;   // L1 gradient magnitude (cv::Canny units)
+        
+        size_t size() const { return x.size(); }
+        void clear() {
+            imageSize = cv::Size();
+            x.clear();
+            y.clear();
+            angle.clear();
+            magnitude.clear();
+        }
+    };
+    
+    /**
+     * HoughLines on an edge list; votes only the listed points instead of
+     * rescanning a dense edge image. Same result as the dense version.
+     * 
+     * @param edges Input edge points (e.g. from Canny)
+     * @param lines Output vector of lines in (rho, theta) format
+     * @param rho Distance resolution of the accumulator in pixels
+     * @param theta Angle resolution of the accumulator in radians
+     * @param threshold Accumulator threshold parameter
+     * @param stats Optional per-call statistics
+     */
+    void HoughLines(const EdgeList& edges, std::vector<cv::Vec2f>& lines,
+                    double rho, double theta, int threshold, HoughStats* stats = nullptr);
+    void HoughLines(const EdgeList& edges, std::vector<cv::Vec2f>& lines,
+                    double rho, double theta, int threshold, HoughWorkspace& ws,
+                    HoughStats* stats = nullptr);
+    
+    /**
+     * Intermediate buffers of Canny, reused across calls on same-sized images
+     */
+    struct CannyWorkspace {
+        cv::Mat dx, dy;                 // Sobel derivatives (CV_16S)
+        cv::Mat magnitude;              // L1 magnitude (CV_16S)
+        cv::Mat marks;                  // NMS / hysteresis state for the edge-list output
+        std::vector<std::vector<ptrdiff_t>> stacks;     // Hysteresis worklists
+        std::vector<int> rowOffsets;    // Edge-list prefix sums
+    };
+    
+    /**
+     * Custom implementation of the Canny edge detector
+     * Follows cv::Canny with apertureSize = 3 and L2gradient = false (replicated
+     * border, same non-maximum suppression comparisons and hysteresis), except
+     * that the outermost pixel frame is never marked as an edge.
+     * SIMD Sobel gradients, row-parallel non-maximum suppression and a
+     * parallel hysteresis stage with lock-free (compare-exchange) worklists.
+     * 
+     * @param src Input image (CV_8U, grayscale)
+     * @param edges Output edge map (CV_8U, 255 = edge) or edge list
+     * @param lowThreshold First threshold for the hysteresis procedure
+     * @param highThreshold Second threshold for the hysteresis procedure
+     */
+    void Canny(const cv::Mat& src, cv::Mat& edges, double lowThreshold, double highThreshold);
+    void Canny(const cv::Mat& src, cv::Mat& edges, double lowThreshold, double highThreshold,
+               CannyWorkspace& ws);
+    void Canny(const cv::Mat& src, EdgeList& edges, double lowThreshold, double highThreshold);
+    void Canny(const cv::Mat& src, EdgeList& edges, double lowThreshold, double highThreshold,
+               CannyWorkspace& ws);
+    
+    /**
+     * Per-call statistics of cornerHarris / cornerHarrisResponse (optional out-parameter).
+     * When a specialized kernel runs Sobel, products, window and response in one
+     * pass, fused is set and the whole pass is counted in responseNs.
+     */
+    struct HarrisStats {
+        bool fused = false;
+        size_t pixelsAboveThreshold = 0;    // Responses kept by the top-10% threshold
+        size_t pixelsAfterMorphology = 0;   // Responses that survived the opening
+        double minResponse = 0;             // Filtered response range before renormalization
+        double maxResponse = 0;
+        int64_t convertNs = 0;
+        int64_t sobelNs = 0;
+        int64_t productsNs = 0;
+        int64_t windowNs = 0;
+        int64_t responseNs = 0;
+        int64_t thresholdNs = 0;
+        int64_t morphologyNs = 0;
+        int64_t normalizeNs = 0;
+    };
     
     /**
      * Custom implementation of Harris Corner Detector
@@ -28,9 +156,11 @@ namespace custom_cv {
      * @param ksize Aperture parameter for Sobel derivative
      * @param k Harris detector free parameter
      * @param borderType Border type for convolution
+     * @param stats Optional per-call statistics
      */
     void cornerHarris(const cv::Mat& src, cv::Mat& dst, int blockSize, 
-                     int ksize, double k, int borderType = cv::BORDER_DEFAULT);
+                     int ksize, double k, int borderType = cv::BORDER_DEFAULT,
+                     HarrisStats* stats = nullptr);
     
     /**
      * Helper function to compute Sobel derivatives
@@ -47,4 +177,395 @@ namespace custom_cv {
      */
     void computeHarrisResponse(const cv::Mat& Ixx, const cv::Mat& Iyy, 
                               const cv::Mat& Ixy, cv::Mat& dst, double k);
-}
\ No newline at end of file
+    
+    /**
+     * Helper function to compute Ix^2, Iy^2 and Ix*Iy in a single parallel pass
+     */
+    void computeDerivativeProducts(const cv::Mat& Ix, const cv::Mat& Iy,
+                                   cv::Mat& Ixx, cv::Mat& Iyy, cv::Mat& Ixy);
+    
+    /**
+     * Intermediate buffers of the Harris pipeline.
+     * Passing the same workspace to repeated calls on same-sized images
+     * keeps the derivative and structure tensor planes from being reallocated.
+     */
+    struct HarrisWorkspace {
+        cv::Mat srcFloat;       // Input converted to float in [0,1]
+        cv::Mat Ix, Iy;         // Sobel derivatives
+        cv::Mat Ixx, Iyy, Ixy;  // Gaussian-weighted structure tensor (generic path only)
+        cv::Mat eroded;         // Opening stage of the cornerHarris strict filter
+    };
+    
+    /**
+     * Raw Harris response, without the strict filtering and renormalization
+     * that cornerHarris applies
+     * 
+     * @param src Input image (grayscale, CV_8U or CV_32F)
+     * @param dst Output response (CV_32F, same size as src)
+     * @param blockSize Size of neighborhood considered for corner detection
+     * @param ksize Aperture parameter for Sobel derivative
+     * @param k Harris detector free parameter
+     * @param ws Reusable intermediate buffers
+     * @param stats Optional per-call statistics (stage timings only)
+     */
+    void cornerHarrisResponse(const cv::Mat& src, cv::Mat& dst, int blockSize,
+                              int ksize, double k, HarrisWorkspace& ws,
+                              HarrisStats* stats = nullptr);
+    
+    /**
+     * cornerHarris variant that keeps its intermediates in a caller-owned workspace,
+     * so Ix/Iy remain available afterwards (e.g. for refineCornersSubPix)
+     */
+    void cornerHarris(const cv::Mat& src, cv::Mat& dst, int blockSize, 
+                     int ksize, double k, HarrisWorkspace& ws,
+                     int borderType = cv::BORDER_DEFAULT, HarrisStats* stats = nullptr);
+    
+    /**
+     * Parameters of the sub-pixel corner refinement stage
+     */
+    struct SubPixParams {
+        bool iterative = true;      // Run gradient-based refinement after the quadratic fit
+        int winRadius = 2;          // Half size of the gradient window
+        int maxIterations = 10;     // Iteration limit of the gradient refinement
+        float epsilon = 0.01f;      // Stop once the position moves less than this (pixels)
+    };
+    
+    /**
+     * Sub-pixel corner refinement (replacement for cv::cornerSubPix on Harris output)
+     * Fits a quadratic to the 3x3 response surface around every peak and, optionally,
+     * iterates the gradient-orthogonality refinement using the Ix/Iy planes that
+     * cornerHarris already left in the workspace. Runs in parallel over the corners.
+     * 
+     * @param response Harris response the peaks were taken from (CV_32F)
+     * @param ws Workspace filled by cornerHarris/cornerHarrisResponse on the same image
+     * @param peaks Integer peak positions (e.g. from FindLocalExtrema / findLocalMaxima)
+     * @param corners Output refined positions, one per peak
+     * @param params Refinement parameters
+     */
+    void refineCornersSubPix(const cv::Mat& response, const HarrisWorkspace& ws,
+                             const std::vector<cv::Point>& peaks,
+                             std::vector<cv::Point2f>& corners,
+                             const SubPixParams& params = SubPixParams());
+    
+    /**
+     * Find strict local maxima of a response map (parallel over rows)
+     * 
+     * @param response Input response map (CV_32F)
+     * @param points Output maxima in row-major order
+     * @param threshold Only responses greater than this value are considered
+     * @param radius Neighborhood radius (1 -> 3x3 window)
+     */
+    void findLocalMaxima(const cv::Mat& response, std::vector<cv::Point>& points,
+                         float threshold, int radius = 1);
+    
+    /**
+     * FAST segment-test corner candidates
+     * Four compass pixels of the circle are tested with SIMD first; only lanes
+     * that survive this quick rejection get the full contiguous-arc test.
+     * 
+     * @param src Input image (CV_8U, grayscale)
+     * @param candidates Output candidate pixels in row-major order
+     * @param threshold Intensity difference of the segment test
+     * @param arcLength Required contiguous arc on the 16-pixel circle: 9 (FAST-9) or 12 (FAST-12)
+     */
+    void detectFASTCandidates(const cv::Mat& src, std::vector<cv::Point>& candidates,
+                              int threshold, int arcLength = 9);
+    
+    /**
+     * Harris response evaluated only at the given pixels, from small local patches.
+     * Gives the same values as cornerHarrisResponse at those pixels, for odd and
+     * even blockSize (the window is anchored like filter2D's).
+     * 
+     * @param src Input image (grayscale, CV_8U or CV_32F)
+     * @param points Pixels to evaluate
+     * @param responses Output response per point
+     * @param blockSize Size of neighborhood considered for corner detection
+     * @param ksize Aperture parameter for Sobel derivative
+     * @param k Harris detector free parameter
+     */
+    void cornerHarrisAt(const cv::Mat& src, const std::vector<cv::Point>& points,
+                        std::vector<float>& responses, int blockSize, int ksize, double k);
+    
+    /**
+     * Harris keypoints restricted to caller-supplied regions of interest.
+     * The response is computed densely inside every ROI (plus the halo the
+     * filters need), so results match a full-frame run inside the ROIs.
+     * 
+     * @param src Input image (grayscale)
+     * @param rois Regions to search (clipped to the image)
+     * @param keypoints Output corners (same format as cornerHarrisFAST)
+     * @param blockSize Size of neighborhood considered for corner detection
+     * @param ksize Aperture parameter for Sobel derivative
+     * @param k Harris detector free parameter
+     * @param threshold Minimum response relative to the strongest response in the ROIs
+     */
+    void cornerHarrisROI(const cv::Mat& src, const std::vector<cv::Rect>& rois,
+                         std::vector<cv::KeyPoint>& keypoints, int blockSize,
+                         int ksize, double k, double threshold = 0.01);
+    
+    /**
+     * Parameters of the FAST-prefiltered Harris mode
+     */
+    struct FastHarrisParams {
+        int fastThreshold = 20;     // Segment test intensity threshold
+        int arcLength = 9;          // 9 = FAST-9, 12 = FAST-12
+        int blockSize = 5;          // Harris neighborhood size
+        int ksize = 3;              // Sobel aperture
+        double k = 0.04;            // Harris detector free parameter
+        double threshold = 0.01;    // Minimum response relative to the strongest candidate
+    };
+    
+    /**
+     * Harris corners evaluated only at FAST candidates.
+     * On low-texture images almost every pixel is rejected by the segment test,
+     * so the structure tensor is computed for a tiny fraction of the frame.
+     * 
+     * @param src Input image (CV_8U, grayscale)
+     * @param keypoints Output corners: pt, size = blockSize, response = Harris response
+     * @param params Detector parameters
+     */
+    void cornerHarrisFAST(const cv::Mat& src, std::vector<cv::KeyPoint>& keypoints,
+                          const FastHarrisParams& params = FastHarrisParams());
+    
+    /**
+     * Streaming Harris detector for line-scan cameras and images too large to hold.
+     * Rows are pushed one at a time and only ksize source rows, blockSize rows of
+     * windowed derivative products and 3 response rows (for the 3x3 maximum test)
+     * are kept in circular buffers, so memory does not depend on the image height.
+     * A corner is emitted as soon as the neighborhood of its response is complete.
+     * 
+     * After pushing every row of a finite image and calling finish(), the emitted
+     * corners are the strict 3x3 maxima of cornerHarrisResponse above the absolute
+     * threshold, i.e. what findLocalMaxima reports on the batch response.
+     */
+    class StreamingHarris {
+    public:
+        /**
+         * @param width Row length in pixels
+         * @param blockSize Size of neighborhood considered for corner detection
+         * @param ksize Aperture parameter for Sobel derivative
+         * @param k Harris detector free parameter
+         * @param threshold Absolute response threshold (the global maximum is never known)
+         */
+        StreamingHarris(int width, int blockSize = 5, int ksize = 3, double k = 0.04,
+                        float threshold = 1e-4f);
+        
+        /**
+         * Feed the next row (CV_8U values are normalized to [0,1] like cornerHarris)
+         * 
+         * @param row 1 x width row, CV_8U or CV_32F
+         * @param corners Corners completed by this row are appended here
+         */
+        void pushRow(const cv::Mat& row, std::vector<cv::KeyPoint>& corners);
+        void pushRow(const uchar* row, std::vector<cv::KeyPoint>& corners);
+        
+        /**
+         * End of image: flush the last rows using the bottom border rule
+         * and append the remaining corners. The engine is reset afterwards.
+         */
+        void finish(std::vector<cv::KeyPoint>& corners);
+        
+        /**
+         * Drop all buffered rows and start a new image
+         */
+        void reset();
+        
+        int rowsReceived() const { return rowsIn; }
+        
+    private:
+        void storeRow(const uchar* row8u, const float* row32f);
+        void advance(int height, std::vector<cv::KeyPoint>& corners);
+        void computeProductRow(int d, int height);
+        void computeResponseRow(int w, int height);
+        void emitRow(int r, std::vector<cv::KeyPoint>& corners);
+        
+        int width;
+        int blockSize;
+        double k;
+        float threshold;
+        int kr;                     // Sobel radius
+        int br;                     // Window radius
+        
+        cv::Mat sobelX, sobelY;     // Sobel kernels (ksize x ksize)
+        cv::Mat window1D;           // 1D Gaussian window (separable)
+        cv::Mat srcRing;            // ksize source rows, reflect-padded by kr
+        cv::Mat prodRing[3];        // blockSize rows of horizontally windowed Ixx, Iyy, Ixy
+        cv::Mat respRing;           // 3 response rows
+        cv::Mat scratch;            // Padded product rows of the row being processed
+        
+        int rowsIn;                 // Source rows received
+        int derivRows;              // Product rows computed
+        int respRows;               // Response rows computed
+        int nmsRow;                 // Next response row to test for maxima
+    };
+    
+    /**
+     * Harris detector for static-camera video that only recomputes what changed.
+     * The frame is split into tiles; a tile is dirty when its mean absolute
+     * difference to the pixels it was last computed from exceeds changeThreshold.
+     * Only dirty tiles plus the halo their pixels influence get a new response,
+     * and only tiles whose response neighborhood changed rerun the maximum test.
+     * Corners of all other tiles are reused, so the per-frame cost follows the
+     * amount of scene change instead of the resolution.
+     */
+    class VideoHarris {
+    public:
+        /**
+         * @param tileSize Tile side in pixels
+         * @param blockSize Size of neighborhood considered for corner detection
+         * @param ksize Aperture parameter for Sobel derivative
+         * @param k Harris detector free parameter
+         * @param threshold Absolute response threshold (a frame-relative one would
+         *                  invalidate every tile whenever the strongest corner changes)
+         * @param changeThreshold Mean absolute pixel difference that marks a tile dirty
+         */
+        VideoHarris(int tileSize = 64, int blockSize = 5, int ksize = 3, double k = 0.04,
+                    float threshold = 1e-4f, double changeThreshold = 2.0);
+        
+        /**
+         * Process the next frame
+         * 
+         * @param frame Input frame (CV_8U, grayscale)
+         * @param keypoints Output corners of the whole frame, grouped by tile:
+         *                  pt, size = blockSize, response = Harris response
+         */
+        void detect(const cv::Mat& frame, std::vector<cv::KeyPoint>& keypoints);
+        
+        /**
+         * Forget the previous frame; the next frame is fully recomputed
+         */
+        void reset();
+        
+        int dirtyTileCount() const { return lastDirtyTiles; }
+        int tileCount() const { return tilesX * tilesY; }
+        const cv::Mat& response() const { return responseMap; }
+        
+    private:
+        cv::Rect tileRect(int index) const;
+        
+        int tileSize;
+        int blockSize;
+        int ksize;
+        double k;
+        float threshold;
+        double changeThreshold;
+        int halo;                   // Distance a changed pixel influences the response
+        
+        int tilesX, tilesY;
+        int lastDirtyTiles;
+        cv::Mat prevFrame;          // Pixels each tile was last computed from
+        cv::Mat responseMap;        // Full-frame response, patched per dirty tile
+        cv::Mat cropResponse;       // Response of one dirty tile plus halo
+        HarrisWorkspace ws;
+        std::vector<uchar> dirty;           // Tile content changed this frame
+        std::vector<uchar> nmsDirty;        // Tile maxima must be recomputed
+        std::vector<std::vector<cv::Point>> tileMaxima;
+        std::vector<std::vector<cv::KeyPoint>> tileCorners;
+    };
+    
+    /**
+     * Multi-scale Harris-Laplace corner detector
+     * Builds a Gaussian pyramid once per frame, computes the Harris response on
+     * every level and keeps a corner only on the level where the scale-normalized
+     * Laplacian-of-Gaussian peaks (its characteristic scale).
+     * Pyramid buffers are allocated once per input size, so a single instance can
+     * be reused across the frames of a video.
+     */
+    class HarrisLaplaceDetector {
+    public:
+        /**
+         * @param numLevels Maximum number of pyramid levels
+         * @param scaleFactor Scale ratio between consecutive levels (> 1)
+         * @param blockSize Harris neighborhood size on every level
+         * @param ksize Aperture parameter for Sobel derivative
+         * @param k Harris detector free parameter
+         * @param threshold Minimum response relative to the strongest response over all levels
+         */
+        HarrisLaplaceDetector(int numLevels = 5, double scaleFactor = 1.4142135623730951,
+                              int blockSize = 5, int ksize = 3, double k = 0.04,
+                              double threshold = 0.01);
+        
+        /**
+         * Detect corners together with their characteristic scale
+         * 
+         * @param src Input image (grayscale)
+         * @param keypoints Output corners: pt in src coordinates, size = blockSize
+         *                  scaled to the selected level, octave = pyramid level,
+         *                  response = Harris response on that level
+         */
+        void detect(const cv::Mat& src, std::vector<cv::KeyPoint>& keypoints);
+        
+    private:
+        void allocate(const cv::Size& size);
+        
+        int numLevels;
+        double scaleFactor;
+        int blockSize;
+        int ksize;
+        double k;
+        double threshold;
+        
+        cv::Size allocatedSize;                     // Input size the buffers below belong to
+        std::vector<double> levelScales;            // Level -> input scale factor
+        std::vector<cv::Mat> pyramid;               // Float levels, level 0 = input
+        std::vector<cv::Mat> blurred;               // Smoothed levels (downsampling and LoG source)
+        std::vector<cv::Mat> laplacians;            // Laplacian of the smoothed levels
+        std::vector<cv::Mat> responses;             // Harris response per level
+        std::vector<HarrisWorkspace> workspaces;    // Harris intermediates per level
+        std::vector<std::vector<cv::Point>> levelMaxima;
+    };
+    
+    /**
+     * Parameters of FrameAnalyzer. Edge thresholds are in cv::Canny units
+     * (8-bit intensities, unnormalized Sobel) so existing settings carry over.
+     */
+    struct FrameAnalyzerParams {
+        int ksize = 3;                  // Sobel aperture shared by edges and Harris
+        double cannyLow = 170.0;        // Hysteresis low threshold
+        double cannyHigh = 200.0;       // Hysteresis high threshold
+        double rho = 1.0;               // Hough distance resolution
+        double theta = CV_PI / 180.0;   // Hough angle resolution
+        int houghThreshold = 80;        // Hough accumulator threshold
+        int blockSize = 5;              // Harris neighborhood size
+        double k = 0.01;                // Harris detector free parameter
+    };
+    
+    /**
+     * Combined Hough + Harris pass over one frame.
+     * Ix/Iy are computed once and feed both the edge map (non-maximum
+     * suppression + hysteresis, as cv::Canny with L1 magnitude) and the Harris
+     * structure tensor, instead of cv::Canny, HoughLines and cornerHarris each
+     * filtering the frame on their own. Buffers are reused across frames.
+     * 
+     * The shared Sobel pass pads with BORDER_REFLECT_101 like cornerHarris,
+     * while cv::Canny pads with BORDER_REPLICATE, so edges within one pixel of
+     * the image border can differ from cv::Canny.
+     */
+    class FrameAnalyzer {
+    public:
+        explicit FrameAnalyzer(const FrameAnalyzerParams& params = FrameAnalyzerParams());
+        
+        /**
+         * Analyze one frame
+         * 
+         * @param src Input image (grayscale)
+         * @param edges Output edge map (CV_8U, 255 = edge), as cv::Canny away from the border
+         * @param lines Output lines of HoughLines run on edges
+         * @param harris Output filtered Harris response, same as cornerHarris
+         */
+        void analyze(const cv::Mat& src, cv::Mat& edges,
+                     std::vector<cv::Vec2f>& lines, cv::Mat& harris);
+        
+        /**
+         * Intermediates of the last frame (shared Ix/Iy and structure tensor)
+         */
+        const HarrisWorkspace& workspace() const { return ws; }
+        
+    private:
+        FrameAnalyzerParams params;
+        HarrisWorkspace ws;
+        HoughWorkspace hough;
+        cv::Mat magnitude;                  // L1 gradient magnitude
+        std::vector<std::vector<ptrdiff_t>> edgeStacks;     // Hysteresis worklists
+    };
+}
@@ -0,0 +1,83 @@
+#include "custom_cv_alloc.h"
+
+namespace custom_cv {
+namespace alloc {
+
+std::atomic<bool> countingFlag(false);
+
+namespace {
+
+    std::atomic<size_t> matAllocations(0);
+    std::atomic<size_t> matBytes(0);
+    std::atomic<size_t> heapAllocations(0);
+    std::atomic<size_t> heapBytes(0);
+    
+    // Forwards to the allocator it replaced. Buffers keep that allocator as
+    // their UMatData::currAllocator, so they are freed the usual way.
+    class CountingMatAllocator : public cv::MatAllocator {
+    public:
+        cv::UMatData* allocate(int dims, const int* sizes, int type, void* data, size_t* step,
+                               cv::AccessFlag flags, cv::UMatUsageFlags usageFlags) const override {
+            cv::UMatData* u = wrapped->allocate(dims, sizes, type, data, step, flags, usageFlags);
+            // User-provided data is wrapped, not allocated
+            if (u && !data && isCountingEnabled()) {
+                matAllocations.fetch_add(1, std::memory_order_relaxed);
+                matBytes.fetch_add(u->size, std::memory_order_relaxed);
+            }
+            return u;
+        }
+        
+        bool allocate(cv::UMatData* u, cv::AccessFlag accessFlags,
+                      cv::UMatUsageFlags usageFlags) const override {
+            return wrapped->allocate(u, accessFlags, usageFlags);
+        }
+        
+        void deallocate(cv::UMatData* u) const override {
+            wrapped->deallocate(u);
+        }
+        
+        cv::MatAllocator* wrapped = nullptr;
+    };
+    
+    CountingMatAllocator& countingAllocator() {
+        static CountingMatAllocator instance;
+        return instance;
+    }
+}
+
+void setCountingEnabled(bool enabled) {
+    CountingMatAllocator& counting = countingAllocator();
+    if (enabled && !isCountingEnabled()) {
+        counting.wrapped = cv::Mat::getDefaultAllocator();
+        cv::Mat::setDefaultAllocator(&counting);
+    } else if (!enabled && isCountingEnabled()) {
+        cv::Mat::setDefaultAllocator(counting.wrapped);
+    }
+    countingFlag.store(enabled, std::memory_order_relaxed);
+}
+
+AllocationCounts counts() {
+    AllocationCounts c;
+    c.matAllocations = matAllocations.load(std::memory_order_relaxed);
+    c.matBytes = matBytes.load(std::memory_order_relaxed);
+    c.heapAllocations = heapAllocations.load(std::memory_order_relaxed);
+    c.heapBytes = heapBytes.load(std::memory_order_relaxed);
+    return c;
+}
+
+void resetCounts() {
+    matAllocations.store(0, std::memory_order_relaxed);
+    matBytes.store(0, std::memory_order_relaxed);
+    heapAllocations.store(0, std::memory_order_relaxed);
+    heapBytes.store(0, std::memory_order_relaxed);
+}
+
+void countHeapAllocation(size_t bytes) {
+    if (isCountingEnabled()) {
+        heapAllocations.fetch_add(1, std::memory_order_relaxed);
+        heapBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+}
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <cstddef>
+
+namespace custom_cv {
+namespace alloc {
+
+    /**
+     * Allocation accounting for finding per-call temporaries.
+     * Mat buffers are counted by a cv::MatAllocator that wraps the default one;
+     * other heap allocations (std::vector growth, UMatData headers, ...) are
+     * counted by the global operator new hook in custom_cv_alloc_hook.h, in
+     * programs that include it. Both count every thread while counting is on.
+     */
+    struct AllocationCounts {
+        size_t matAllocations = 0;      // cv::Mat data buffers
+        size_t matBytes = 0;
+        size_t heapAllocations = 0;     // operator new calls (hook only)
+        size_t heapBytes = 0;
+        
+        size_t total() const { return matAllocations + heapAllocations; }
+    };
+    
+    /**
+     * Start or stop counting. Enabling installs the counting allocator as the
+     * cv::Mat default allocator on top of the current one; disabling restores it.
+     * Call it while no other thread is creating Mats.
+     */
+    void setCountingEnabled(bool enabled);
+    
+    extern std::atomic<bool> countingFlag;      // Use setCountingEnabled/isCountingEnabled
+    
+    inline bool isCountingEnabled() {
+        return countingFlag.load(std::memory_order_relaxed);
+    }
+    
+    /**
+     * Totals since the last resetCounts()
+     */
+    AllocationCounts counts();
+    void resetCounts();
+    
+    /**
+     * Record one heap allocation (called by the operator new hook)
+     */
+    void countHeapAllocation(size_t bytes);
+    
+    /**
+     * Allocations made between construction and counts(), e.g. around one call
+     */
+    class AllocationScope {
+    public:
+        AllocationScope() : begin(alloc::counts()) {}
+        
+        AllocationCounts counts() const {
+            AllocationCounts now = alloc::counts();
+            now.matAllocations -= begin.matAllocations;
+            now.matBytes -= begin.matBytes;
+            now.heapAllocations -= begin.heapAllocations;
+            now.heapBytes -= begin.heapBytes;
+            return now;
+        }
+    
+    private:
+        AllocationCounts begin;
+    };
+}
+}
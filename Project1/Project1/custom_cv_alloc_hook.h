@@ -0,0 +1,47 @@
+#pragma once
+#include "custom_cv_alloc.h"
+#include <cstdlib>
+#include <new>
+
+// Global operator new/delete replacement that feeds custom_cv::alloc's heap
+// counters. Include it in exactly one translation unit of a program (the file
+// with main); the library itself never replaces the global operators.
+// On MSVC the replacement only sees allocations of the program's own module,
+// i.e. custom_cv and the caller, not those made inside the OpenCV DLL.
+
+void* operator new(std::size_t size) {
+    custom_cv::alloc::countHeapAllocation(size);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    custom_cv::alloc::countHeapAllocation(size);
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
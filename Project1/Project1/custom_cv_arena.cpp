@@ -0,0 +1,187 @@
+#include "custom_cv_arena.h"
+#include <opencv2/core/utils/logger.hpp>
+#include <algorithm>
+#include <new>
+
+namespace custom_cv {
+
+namespace {
+
+    const size_t PAGE_BYTES = 4096;
+    
+    size_t alignUp(size_t n, size_t alignment) {
+        return (n + alignment - 1) & ~(alignment - 1);
+    }
+    
+    // Header and buffer share one block: [UMatData][pad][data]
+    const size_t HEADER_SIZE = alignUp(sizeof(cv::UMatData), FrameArena::ALIGNMENT);
+}
+
+// Buffers keep this allocator as their UMatData::currAllocator; the arena's
+// control block travels in UMatData::userdata so any thread can release the
+// block, even after the arena's thread has exited
+class FrameArenaAllocator : public cv::MatAllocator {
+public:
+    cv::UMatData* allocate(int dims, const int* sizes, int type, void* data, size_t* step,
+                           cv::AccessFlag flags, cv::UMatUsageFlags usageFlags) const override {
+        FrameArena& arena = FrameArena::local();
+        // Wrapping user memory needs no buffer; outside a frame nothing would rewind the arena
+        if (data || !arena.inFrame()) {
+            if (!data) arena.counters.fallbacks++;
+            return fallback()->allocate(dims, sizes, type, data, step, flags, usageFlags);
+        }
+        
+        // Continuous layout, as cv::Mat's standard allocator
+        size_t total = CV_ELEM_SIZE(type);
+        for (int i = dims - 1; i >= 0; i--) {
+            if (step) step[i] = total;
+            total *= sizes[i];
+        }
+        
+        uchar* block = arena.allocateBlock(HEADER_SIZE + total);
+        cv::UMatData* u = new (block) cv::UMatData(this);
+        u->data = u->origdata = block + HEADER_SIZE;
+        u->size = total;
+        u->userdata = arena.control;
+        arena.control->refs.fetch_add(1, std::memory_order_relaxed);
+        return u;
+    }
+    
+    bool allocate(cv::UMatData* u, cv::AccessFlag, cv::UMatUsageFlags) const override {
+        return u != nullptr;
+    }
+    
+    void deallocate(cv::UMatData* u) const override {
+        if (!u) return;
+        CV_Assert(u->urefcount == 0 && u->refcount == 0);
+        FrameArena::Control* control = static_cast<FrameArena::Control*>(u->userdata);
+        // The memory itself is reclaimed when the arena rewinds (or with the
+        // last block, if the arena is already gone)
+        u->~UMatData();
+        FrameArena::release(control);
+    }
+
+private:
+    const cv::MatAllocator* fallback() const {
+        cv::MatAllocator* a = cv::Mat::getDefaultAllocator();
+        return a == this ? cv::Mat::getStdAllocator() : a;
+    }
+};
+
+FrameArena& FrameArena::local() {
+    thread_local FrameArena arena;
+    return arena;
+}
+
+cv::MatAllocator* FrameArena::allocator() {
+    static FrameArenaAllocator instance;
+    return &instance;
+}
+
+FrameArena::~FrameArena() {
+    // Blocks still referenced (a Mat that outlived its thread) keep the chunks
+    // alive; the last of them frees them through the control block
+    if (liveBlocks() != 0) {
+        CV_LOG_WARNING(NULL, "custom_cv::FrameArena: thread exits with arena Mats still alive");
+    }
+    control->orphans.swap(chunks);
+    release(control);
+}
+
+void FrameArena::release(Control* control) {
+    if (control->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+    for (const Chunk& c : control->orphans) {
+        cv::fastFree(c.base);
+    }
+    delete control;
+}
+
+uchar* FrameArena::allocateBlock(size_t bytes) {
+    bytes = alignUp(bytes, ALIGNMENT);
+    while (current < chunks.size() && offset + bytes > chunks[current].size) {
+        current++;
+        offset = 0;
+    }
+    if (current == chunks.size()) {
+        // Geometric growth keeps the number of chunks per frame small
+        size_t size = chunks.empty() ? DEFAULT_CHUNK_SIZE : chunks.back().size * 2;
+        addChunk(std::max(size, bytes));
+        offset = 0;
+    }
+    
+    uchar* block = chunks[current].base + offset;
+    offset += bytes;
+    bytesInUse += bytes;
+    return block;
+}
+
+void FrameArena::reset() {
+    if (liveBlocks() != 0) {
+        // Rewinding now would hand out memory that is still referenced
+        if (counters.deferredResets++ == 0) {
+            CV_LOG_WARNING(NULL, "custom_cv::FrameArena: arena Mats outlived their frame; reset deferred");
+        }
+        return;
+    }
+    
+    counters.peakBytes = std::max(counters.peakBytes, bytesInUse);
+    counters.resets++;
+    
+    // A frame that spilled over several chunks gets one chunk big enough for all of them
+    if (chunks.size() > 1) {
+        size_t total = 0;
+        for (const Chunk& c : chunks) {
+            total += c.size;
+            cv::fastFree(c.base);
+        }
+        chunks.clear();
+        reserve(total);
+    }
+    current = 0;
+    offset = 0;
+    bytesInUse = 0;
+}
+
+void FrameArena::reserve(size_t bytes) {
+    size_t capacity = 0;
+    for (const Chunk& c : chunks) {
+        capacity += c.size;
+    }
+    if (capacity >= bytes || inFrame()) {
+        return;
+    }
+    CV_Assert(liveBlocks() == 0);
+    
+    for (const Chunk& c : chunks) {
+        cv::fastFree(c.base);
+    }
+    chunks.clear();
+    current = offset = 0;
+    addChunk(bytes);
+}
+
+void FrameArena::addChunk(size_t bytes) {
+    Chunk c;
+    c.size = alignUp(bytes, PAGE_BYTES);
+    c.base = static_cast<uchar*>(cv::fastMalloc(c.size));
+    // Take the page faults now rather than inside the first frames that use them
+    for (size_t p = 0; p < c.size; p += PAGE_BYTES) {
+        c.base[p] = 0;
+    }
+    chunks.push_back(c);
+    counters.chunkAllocations++;
+}
+
+FrameArena::Stats FrameArena::stats() const {
+    Stats s = counters;
+    s.bytesInUse = bytesInUse;
+    s.peakBytes = std::max(s.peakBytes, bytesInUse);
+    for (const Chunk& c : chunks) {
+        s.capacity += c.size;
+    }
+    return s;
+}
+
+}
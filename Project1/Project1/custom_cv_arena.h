@@ -0,0 +1,126 @@
+#pragma once
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace custom_cv {
+
+    /**
+     * Per-thread bump allocator for the temporaries of one frame.
+     * Mat buffers are carved from large chunks that stay mapped across frames,
+     * each block starting on a 64-byte boundary, and are all released at once
+     * when the outermost FrameArena::Scope of the thread ends. After the first
+     * few frames the per-frame path neither calls malloc/free nor touches fresh
+     * pages, and threads never contend on a shared heap lock.
+     *
+     * Usage: open a Scope for the frame, then give the temporaries the arena
+     * allocator (FrameArena::mat(), or set cv::Mat::allocator = FrameArena::allocator()).
+     * Only Mats that die before the scope ends may use the arena; outputs that
+     * outlive the frame must keep the default allocator.
+     */
+    class FrameArena {
+    public:
+        static const size_t ALIGNMENT = 64;                 // Cache line / AVX-512 vector
+        static const size_t DEFAULT_CHUNK_SIZE = 4 << 20;   // First chunk of every thread
+        
+        struct Stats {
+            size_t bytesInUse = 0;      // Handed out since the last reset
+            size_t peakBytes = 0;       // Largest bytesInUse at any reset
+            size_t capacity = 0;        // Bytes held in chunks
+            size_t chunkAllocations = 0;    // Chunks obtained from the heap so far
+            size_t resets = 0;          // Frames rewound
+            size_t deferredResets = 0;  // Frame ends skipped because blocks were still referenced
+            size_t fallbacks = 0;       // Allocations outside any Scope (served by the default allocator)
+        };
+        
+        /**
+         * Arena of the calling thread
+         */
+        static FrameArena& local();
+        
+        /**
+         * cv::MatAllocator that serves each Mat from the arena of the thread creating it.
+         * A thread that is not inside a Scope gets buffers from the default allocator,
+         * so worker threads without a frame of their own never accumulate memory.
+         */
+        static cv::MatAllocator* allocator();
+        
+        /**
+         * Empty Mat header bound to the arena allocator
+         */
+        static cv::Mat mat() {
+            cv::Mat m;
+            m.allocator = allocator();
+            return m;
+        }
+        
+        /**
+         * Marks one frame on the calling thread. Scopes nest; the arena is rewound
+         * when the outermost one ends. If arena Mats are still referenced at that
+         * point the rewind is deferred to a later frame end (and counted in Stats).
+         */
+        class Scope {
+        public:
+            Scope() : arena(local()) { arena.depth++; }
+            ~Scope() {
+                if (--arena.depth == 0) arena.reset();
+            }
+            
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        
+        private:
+            FrameArena& arena;
+        };
+        
+        /**
+         * Pre-size the arena so that even the first frame does not grow it
+         */
+        void reserve(size_t bytes);
+        
+        bool inFrame() const { return depth > 0; }
+        Stats stats() const;
+        
+        ~FrameArena();
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+    
+    private:
+        friend class FrameArenaAllocator;
+        
+        struct Chunk {
+            uchar* base;
+            size_t size;
+        };
+        
+        // Heap block shared by the arena and its live Mat buffers, so a buffer
+        // released after its thread (and arena) has exited still has a valid
+        // counter. Holds one reference per live block plus one for the arena;
+        // whoever drops the last one frees the block and any orphaned chunks.
+        struct Control {
+            std::atomic<size_t> refs{1};
+            std::vector<Chunk> orphans;     // Chunks of an arena that exited before its blocks
+        };
+        
+        FrameArena() = default;
+        
+        static void release(Control* control);
+        size_t liveBlocks() const { return control->refs.load(std::memory_order_acquire) - 1; }
+        
+        // Bump-allocate an aligned block, growing by a new chunk if needed
+        uchar* allocateBlock(size_t bytes);
+        void addChunk(size_t bytes);
+        
+        // Rewind to empty; merges the chunks into one once the frame size is known
+        void reset();
+        
+        std::vector<Chunk> chunks;
+        size_t current = 0;             // Chunk being bumped
+        size_t offset = 0;              // Next free byte in chunks[current]
+        size_t bytesInUse = 0;          // Includes alignment padding and UMatData headers
+        int depth = 0;                  // Open Scopes
+        Control* control = new Control();   // Blocks may be released on another thread
+        Stats counters;
+    };
+}
@@ -0,0 +1,164 @@
+// Baseline kernels (project-wide instruction set) and variant selection
+#define CUSTOM_CV_KERNEL_NS baseline
+#include "custom_cv_kernels.h"
+#include "custom_cv_dispatch.h"
+#include "custom_cv_parallel.h"
+#include <opencv2/core/utils/logger.hpp>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace custom_cv {
+namespace dispatch {
+
+static std::string readVariantOverride() {
+    std::string value;
+#ifdef _MSC_VER
+    char* buffer = nullptr;
+    size_t length = 0;
+    if (_dupenv_s(&buffer, &length, "CUSTOM_CV_CPU_VARIANT") == 0 && buffer) {
+        value = buffer;
+        free(buffer);
+    }
+#else
+    if (const char* env = std::getenv("CUSTOM_CV_CPU_VARIANT")) {
+        value = env;
+    }
+#endif
+    return value;
+}
+
+static const KernelTable& selectKernelTable() {
+    struct Candidate {
+        bool supported;
+        const KernelTable& (*table)();
+    };
+    
+    // Widest first; each variant needs every extension its /arch flag allows
+    const Candidate candidates[] = {
+        { cv::checkHardwareSupport(CV_CPU_AVX512_SKX), avx512::kernelTable },
+        { cv::checkHardwareSupport(CV_CPU_AVX2) && cv::checkHardwareSupport(CV_CPU_FMA3), avx2::kernelTable },
+        { cv::checkHardwareSupport(CV_CPU_SSE4_2) && cv::checkHardwareSupport(CV_CPU_POPCNT), sse42::kernelTable },
+        { true, baseline::kernelTable }
+    };
+    
+    std::string forced = readVariantOverride();
+    if (!forced.empty()) {
+        for (const auto& c : candidates) {
+            if (forced != c.table().name) continue;
+            
+            if (c.supported) {
+                CV_LOG_INFO(NULL, "custom_cv: using " << c.table().name
+                            << " kernels (forced by CUSTOM_CV_CPU_VARIANT)");
+                return c.table();
+            }
+            CV_LOG_WARNING(NULL, "custom_cv: CUSTOM_CV_CPU_VARIANT=" << forced
+                           << " is not supported by this CPU, ignoring it");
+            break;
+        }
+    }
+    
+    for (const auto& c : candidates) {
+        if (c.supported) {
+            if (!forced.empty() && forced != c.table().name) {
+                CV_LOG_WARNING(NULL, "custom_cv: unknown or unusable CUSTOM_CV_CPU_VARIANT=" << forced);
+            }
+            CV_LOG_INFO(NULL, "custom_cv: using " << c.table().name << " kernels");
+            return c.table();
+        }
+    }
+    return baseline::kernelTable();
+}
+
+const KernelTable& kernelTable() {
+    // Thread-safe one-time selection
+    static const KernelTable& table = selectKernelTable();
+    return table;
+}
+
+// Per-thread row scratch that only grows, so steady-state calls do not allocate
+// (the worker threads of cv::parallel_for_ persist between calls)
+template<typename T>
+static T* threadScratch(size_t count) {
+    thread_local std::vector<T> buffer;
+    if (buffer.size() < count) {
+        buffer.resize(count);
+    }
+    return buffer.data();
+}
+
+bool sobelDerivatives(const cv::Mat& src, cv::Mat& Ix, cv::Mat& Iy, int ksize) {
+    if (src.type() != CV_32F) return false;
+    if (ksize != 3 && ksize != 5 && ksize != 7) return false;
+    
+    Ix.create(src.size(), CV_32F);
+    Iy.create(src.size(), CV_32F);
+    const int rows = src.rows;
+    const int cols = src.cols;
+    const auto sobelRows = kernelTable().sobelRows;
+    
+    parallelFor(cv::Range(0, rows), [&](const cv::Range& range) {
+        float* scratch = threadScratch<float>(2 * (cols + 2 * (ksize / 2)));
+        sobelRows(src.ptr<float>(), src.step1(), rows, cols, ksize,
+                  Ix.ptr<float>(), Ix.step1(), Iy.ptr<float>(), Iy.step1(),
+                  range.start, range.end, scratch);
+    });
+    return true;
+}
+
+bool harrisResponseFromGradients(const cv::Mat& Ix, const cv::Mat& Iy, cv::Mat& dst,
+                                 int blockSize, double k) {
+    if (blockSize != 3 && blockSize != 5 && blockSize != 7) return false;
+    
+    dst.create(Ix.size(), CV_32F);
+    const int rows = Ix.rows;
+    const int cols = Ix.cols;
+    const float kf = static_cast<float>(k);
+    const auto harrisRows = kernelTable().harrisRows;
+    
+    parallelFor(cv::Range(0, rows), [&](const cv::Range& range) {
+        float* scratch = threadScratch<float>(3 * (cols + 2 * (blockSize / 2)));
+        harrisRows(Ix.ptr<float>(), Ix.step1(), Iy.ptr<float>(), Iy.step1(),
+                   rows, cols, blockSize, kf, dst.ptr<float>(), dst.step1(),
+                   range.start, range.end, scratch);
+    });
+    return true;
+}
+
+bool harrisResponse(const cv::Mat& src, cv::Mat& Ix, cv::Mat& Iy, cv::Mat& dst,
+                    int ksize, int blockSize, double k) {
+    if (src.type() != CV_32F) return false;
+    
+    const bool supported = (ksize == 3 && blockSize == 3) || (ksize == 3 && blockSize == 5) ||
+                           (ksize == 5 && blockSize == 5) || (ksize == 7 && blockSize == 7);
+    if (!supported) return false;
+    
+    sobelDerivatives(src, Ix, Iy, ksize);
+    harrisResponseFromGradients(Ix, Iy, dst, blockSize, k);
+    return true;
+}
+
+void houghVote(const int* xs, const int* ys, size_t count,
+               const double* cosTable, const double* sinTable, int numAngles,
+               double maxDist, double rho, cv::Mat& accumulator) {
+    int* bins = threadScratch<int>(numAngles);
+    kernelTable().houghVote(xs, ys, count, cosTable, sinTable, numAngles, maxDist, rho,
+                            accumulator.ptr<int>(), accumulator.rows, accumulator.step1(), bins);
+}
+
+void localMaxima(const cv::Mat& response, const cv::Rect& rect,
+                 float threshold, int radius, std::vector<cv::Point>& out) {
+    const auto localMaximaRow = kernelTable().localMaximaRow;
+    int* xs = threadScratch<int>(rect.width);
+    
+    for (int y = rect.y; y < rect.y + rect.height; y++) {
+        int found = localMaximaRow(response.ptr<float>(), response.step1(), y,
+                                   rect.x, rect.x + rect.width, threshold, radius, xs);
+        for (int i = 0; i < found; i++) {
+            out.push_back(cv::Point(xs[i], y));
+        }
+    }
+}
+
+}
+}
\ No newline at end of file
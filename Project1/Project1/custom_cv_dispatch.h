@@ -0,0 +1,58 @@
+#pragma once
+#include "custom_cv_kernel_table.h"
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+namespace custom_cv {
+namespace dispatch {
+
+    /**
+     * Kernels for this CPU. Selected on first use from cv::checkHardwareSupport;
+     * the environment variable CUSTOM_CV_CPU_VARIANT (baseline, sse42, avx2,
+     * avx512) forces a variant for testing. The choice is logged once.
+     */
+    const KernelTable& kernelTable();
+
+    // cv::Mat entry points of the dispatched kernels. They allocate the outputs,
+    // provide per-thread scratch and split rows over cv::parallel_for_ in the
+    // baseline translation unit, then call kernelTable() with raw pointers.
+
+    /**
+     * Specialized Sobel for the given aperture (3, 5 or 7)
+     *
+     * @return false when no specialization exists (caller uses the generic path)
+     */
+    bool sobelDerivatives(const cv::Mat& src, cv::Mat& Ix, cv::Mat& Iy, int ksize);
+
+    /**
+     * Specialized windowed response for the given window size (3, 5 or 7)
+     *
+     * @return false when no specialization exists (caller uses the generic path)
+     */
+    bool harrisResponseFromGradients(const cv::Mat& Ix, const cv::Mat& Iy, cv::Mat& dst,
+                                     int blockSize, double k);
+
+    /**
+     * Full Harris response for the common (ksize, blockSize) combinations
+     * (3,3), (3,5), (5,5) and (7,7)
+     *
+     * @return false for any other combination (caller uses the generic path)
+     */
+    bool harrisResponse(const cv::Mat& src, cv::Mat& Ix, cv::Mat& Iy, cv::Mat& dst,
+                        int ksize, int blockSize, double k);
+
+    /**
+     * Hough voting into accumulator (numRhos x numAngles, CV_32S)
+     */
+    void houghVote(const int* xs, const int* ys, size_t count,
+                   const double* cosTable, const double* sinTable, int numAngles,
+                   double maxDist, double rho, cv::Mat& accumulator);
+
+    /**
+     * Strict local maxima of response inside rect (rect must keep radius pixels
+     * away from the image border). Ties go to the first pixel in scan order.
+     */
+    void localMaxima(const cv::Mat& response, const cv::Rect& rect,
+                     float threshold, int radius, std::vector<cv::Point>& out);
+}
+}
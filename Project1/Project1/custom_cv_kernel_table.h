@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+
+// Table of the CPU-dispatched kernels. This header is shared by the variant
+// translation units (custom_cv_kernels_*.cpp), which are compiled with wider
+// /arch flags than the rest of the program, so it must not pull in OpenCV or
+// STL types: any inline function those TUs instantiate (std::vector growth,
+// cv::Mat members, ...) is emitted as a COMDAT and the linker may keep the
+// AVX-512 copy for the whole program. Kernels work on raw pointers and
+// strides; allocation, scratch buffers and threading stay in the baseline
+// code (see the wrappers in custom_cv_dispatch.h).
+
+namespace custom_cv {
+namespace dispatch {
+
+    /**
+     * Hot kernels of custom_cv, bound once to the variant built for the widest
+     * instruction set the CPU supports (see custom_cv_kernels.h for the bodies).
+     * Strides are in elements. Row kernels process rows [yBegin, yEnd) of an
+     * image with the given size, so the caller can split the rows over threads.
+     * Kernels returning bool report false when they have no specialization for
+     * the given parameters; the caller then runs its generic path.
+     */
+    struct KernelTable {
+        const char* name;       // Variant name: baseline, sse42, avx2 or avx512
+
+        // Sobel derivatives of a CV_32F image (ksize 3, 5 or 7).
+        // scratch: 2 * (cols + 2 * (ksize / 2)) floats, owned by the calling thread
+        bool (*sobelRows)(const float* src, size_t srcStep, int rows, int cols, int ksize,
+                          float* ix, size_t ixStep, float* iy, size_t iyStep,
+                          int yBegin, int yEnd, float* scratch);
+
+        // Products, Gaussian window and Harris response (blockSize 3, 5 or 7).
+        // scratch: 3 * (cols + 2 * (blockSize / 2)) floats, owned by the calling thread
+        bool (*harrisRows)(const float* ix, size_t ixStep, const float* iy, size_t iyStep,
+                           int rows, int cols, int blockSize, float k,
+                           float* dst, size_t dstStep, int yBegin, int yEnd, float* scratch);
+
+        // Hough votes of count points into a numRhos x numAngles CV_32S accumulator.
+        // bins: numAngles ints
+        void (*houghVote)(const int* xs, const int* ys, size_t count,
+                          const double* cosTable, const double* sinTable, int numAngles,
+                          double maxDist, double rho, int* votes, int numRhos, size_t voteStep,
+                          int* bins);
+
+        // Strict local maxima in row y, columns [xBegin, xEnd) (radius pixels away
+        // from the border). Writes the x coordinates to xs and returns their count.
+        int (*localMaximaRow)(const float* response, size_t step, int y, int xBegin, int xEnd,
+                              float threshold, int radius, int* xs);
+    };
+
+    // One table per variant, each in its own translation unit
+    namespace baseline { const KernelTable& kernelTable(); }
+    namespace sse42 { const KernelTable& kernelTable(); }
+    namespace avx2 { const KernelTable& kernelTable(); }
+    namespace avx512 { const KernelTable& kernelTable(); }
+}
+}
@@ -0,0 +1,338 @@
+#pragma once
+#include "custom_cv_kernel_table.h"
+#include <math.h>
+
+// Kernel bodies shared by every CPU variant. Each variant translation unit
+// defines CUSTOM_CV_KERNEL_NS, includes this header once and is compiled with
+// its own instruction set, so every variant gets distinct symbols.
+// The bodies are plain scalar C++; the variants differ only in the /arch flag
+// the compiler auto-vectorizes them with.
+//
+// Everything here stays inside the variant namespace and only calls code
+// from that namespace (plus the C library's round): no OpenCV or STL inline
+// functions, whose COMDAT copies built with AVX-512 could otherwise be picked
+// by the linker for the whole program (see custom_cv_kernel_table.h).
+#ifndef CUSTOM_CV_KERNEL_NS
+#define CUSTOM_CV_KERNEL_NS baseline
+#endif
+
+#define CUSTOM_CV_KERNEL_STR2(x) #x
+#define CUSTOM_CV_KERNEL_STR(x) CUSTOM_CV_KERNEL_STR2(x)
+
+namespace custom_cv {
+namespace kernels {
+namespace CUSTOM_CV_KERNEL_NS {
+
+    /**
+     * Separable Sobel taps: kernel = smooth (across) x deriv (along), times scale.
+     * Same coefficients as createSobelKernels in custom_cv.cpp.
+     */
+    template<int KSize> struct SobelTaps;
+    
+    template<> struct SobelTaps<3> {
+        static constexpr float smooth(int i) { return i == 1 ? 2.0f : 1.0f; }
+        static constexpr float deriv(int i) { return static_cast<float>(i - 1); }
+        static constexpr float scale() { return 1.0f; }
+    };
+    
+    template<> struct SobelTaps<5> {
+        static constexpr float smooth(int i) {
+            constexpr float t[5] = { 1, 4, 6, 4, 1 };
+            return t[i];
+        }
+        static constexpr float deriv(int i) {
+            constexpr float t[5] = { -1, -2, 0, 2, 1 };
+            return t[i];
+        }
+        static constexpr float scale() { return 1.0f / 48.0f; }
+    };
+    
+    template<> struct SobelTaps<7> {
+        static constexpr float smooth(int i) {
+            constexpr float t[7] = { 1, 6, 15, 20, 15, 6, 1 };
+            return t[i];
+        }
+        static constexpr float deriv(int i) {
+            constexpr float t[7] = { -1, -4, -5, 0, 5, 4, 1 };
+            return t[i];
+        }
+        static constexpr float scale() { return 1.0f / 640.0f; }
+    };
+    
+    /**
+     * Gaussian window taps, equal to cv::getGaussianKernel(BlockSize, -1)
+     * (the fixed small kernels OpenCV uses for sizes up to 7)
+     */
+    template<int BlockSize> struct WindowTaps;
+    
+    template<> struct WindowTaps<3> {
+        static constexpr float tap(int i) { return i == 1 ? 0.5f : 0.25f; }
+    };
+    
+    template<> struct WindowTaps<5> {
+        static constexpr float tap(int i) {
+            constexpr float t[5] = { 0.0625f, 0.25f, 0.375f, 0.25f, 0.0625f };
+            return t[i];
+        }
+    };
+    
+    template<> struct WindowTaps<7> {
+        static constexpr float tap(int i) {
+            constexpr float t[7] = { 0.03125f, 0.109375f, 0.21875f, 0.28125f,
+                                     0.21875f, 0.109375f, 0.03125f };
+            return t[i];
+        }
+    };
+    
+    // BORDER_REFLECT_101 index (cv::borderInterpolate without the inline OpenCV code)
+    inline int reflect101(int i, int n) {
+        if (n == 1) return 0;
+        while (i < 0 || i >= n) {
+            i = i < 0 ? -i : 2 * (n - 1) - i;
+        }
+        return i;
+    }
+    
+    // Fill radius columns on each side of a row buffer (reflect-101, as filter2D)
+    inline void reflectColumns(float* row, int cols, int radius) {
+        for (int i = 1; i <= radius; i++) {
+            row[-i] = row[reflect101(-i, cols)];
+            row[cols - 1 + i] = row[reflect101(cols - 1 + i, cols)];
+        }
+    }
+    
+    /**
+     * Sobel derivatives with a fixed aperture: a vertical pass then a horizontal
+     * pass per row, using the symmetry of the smoothing taps and the
+     * antisymmetry (zero center) of the derivative taps. The tap loops have
+     * compile-time trip counts and are unrolled by the compiler.
+     * 
+     * @param src Input image (CV_32F), srcStep floats per row
+     * @param ix Output x derivative
+     * @param iy Output y derivative
+     * @param scratch 2 * (cols + 2 * (KSize / 2)) floats
+     */
+    template<int KSize>
+    void sobel(const float* src, size_t srcStep, int rows, int cols,
+               float* ix, size_t ixStep, float* iy, size_t iyStep,
+               int yBegin, int yEnd, float* scratch) {
+        typedef SobelTaps<KSize> Taps;
+        const int R = KSize / 2;
+        float* vs = scratch + R;                        // Vertically smoothed
+        float* vd = scratch + cols + 3 * R;             // Vertically differentiated
+        const float* srcRows[KSize];
+        
+        for (int y = yBegin; y < yEnd; y++) {
+            for (int j = 0; j < KSize; j++) {
+                srcRows[j] = src + reflect101(y + j - R, rows) * srcStep;
+            }
+            
+            // Vertical pass
+            for (int x = 0; x < cols; x++) {
+                float s = Taps::smooth(R) * srcRows[R][x];
+                float d = 0.0f;
+                for (int i = 1; i <= R; i++) {
+                    float up = srcRows[R - i][x];
+                    float down = srcRows[R + i][x];
+                    s += Taps::smooth(R + i) * (up + down);
+                    d += Taps::deriv(R + i) * (down - up);
+                }
+                vs[x] = s;
+                vd[x] = d;
+            }
+            reflectColumns(vs, cols, R);
+            reflectColumns(vd, cols, R);
+            
+            // Horizontal pass
+            float* ixRow = ix + y * ixStep;
+            float* iyRow = iy + y * iyStep;
+            for (int x = 0; x < cols; x++) {
+                float gx = 0.0f;
+                float gy = Taps::smooth(R) * vd[x];
+                for (int i = 1; i <= R; i++) {
+                    gx += Taps::deriv(R + i) * (vs[x + i] - vs[x - i]);
+                    gy += Taps::smooth(R + i) * (vd[x + i] + vd[x - i]);
+                }
+                ixRow[x] = gx * Taps::scale();
+                iyRow[x] = gy * Taps::scale();
+            }
+        }
+    }
+    
+    /**
+     * Products, Gaussian window and Harris response in one pass: each output row
+     * windows Ix^2, Iy^2 and Ix*Iy vertically straight from the derivative rows,
+     * then horizontally, so the three product planes are never written.
+     * 
+     * @param ix X derivative (CV_32F)
+     * @param iy Y derivative (CV_32F)
+     * @param dst Output response (CV_32F)
+     * @param k Harris detector free parameter
+     * @param scratch 3 * (cols + 2 * (BlockSize / 2)) floats
+     */
+    template<int BlockSize>
+    void harrisFromGradients(const float* ix, size_t ixStep, const float* iy, size_t iyStep,
+                             int rows, int cols, float k, float* dst, size_t dstStep,
+                             int yBegin, int yEnd, float* scratch) {
+        typedef WindowTaps<BlockSize> Taps;
+        const int R = BlockSize / 2;
+        const int padded = cols + 2 * R;
+        float* sxx = scratch + R;
+        float* syy = sxx + padded;
+        float* sxy = syy + padded;
+        const float* ixRows[BlockSize];
+        const float* iyRows[BlockSize];
+        
+        for (int y = yBegin; y < yEnd; y++) {
+            for (int j = 0; j < BlockSize; j++) {
+                int yy = reflect101(y + j - R, rows);
+                ixRows[j] = ix + yy * ixStep;
+                iyRows[j] = iy + yy * iyStep;
+            }
+            
+            // Vertical window over the products
+            for (int x = 0; x < cols; x++) {
+                float xx = 0.0f, yy = 0.0f, xy = 0.0f;
+                for (int j = 0; j < BlockSize; j++) {
+                    float gx = ixRows[j][x];
+                    float gy = iyRows[j][x];
+                    float w = Taps::tap(j);
+                    xx += w * gx * gx;
+                    yy += w * gy * gy;
+                    xy += w * gx * gy;
+                }
+                sxx[x] = xx;
+                syy[x] = yy;
+                sxy[x] = xy;
+            }
+            reflectColumns(sxx, cols, R);
+            reflectColumns(syy, cols, R);
+            reflectColumns(sxy, cols, R);
+            
+            // Horizontal window and response
+            float* dstRow = dst + y * dstStep;
+            for (int x = 0; x < cols; x++) {
+                float xx = Taps::tap(R) * sxx[x];
+                float yy = Taps::tap(R) * syy[x];
+                float xy = Taps::tap(R) * sxy[x];
+                for (int i = 1; i <= R; i++) {
+                    float w = Taps::tap(R + i);
+                    xx += w * (sxx[x + i] + sxx[x - i]);
+                    yy += w * (syy[x + i] + syy[x - i]);
+                    xy += w * (sxy[x + i] + sxy[x - i]);
+                }
+                float det = xx * yy - xy * xy;
+                float trace = xx + yy;
+                dstRow[x] = det - k * trace * trace;
+            }
+        }
+    }
+    
+    inline bool sobelRows(const float* src, size_t srcStep, int rows, int cols, int ksize,
+                          float* ix, size_t ixStep, float* iy, size_t iyStep,
+                          int yBegin, int yEnd, float* scratch) {
+        switch (ksize) {
+        case 3: sobel<3>(src, srcStep, rows, cols, ix, ixStep, iy, iyStep, yBegin, yEnd, scratch); return true;
+        case 5: sobel<5>(src, srcStep, rows, cols, ix, ixStep, iy, iyStep, yBegin, yEnd, scratch); return true;
+        case 7: sobel<7>(src, srcStep, rows, cols, ix, ixStep, iy, iyStep, yBegin, yEnd, scratch); return true;
+        default: return false;
+        }
+    }
+    
+    inline bool harrisRows(const float* ix, size_t ixStep, const float* iy, size_t iyStep,
+                           int rows, int cols, int blockSize, float k,
+                           float* dst, size_t dstStep, int yBegin, int yEnd, float* scratch) {
+        switch (blockSize) {
+        case 3: harrisFromGradients<3>(ix, ixStep, iy, iyStep, rows, cols, k, dst, dstStep, yBegin, yEnd, scratch); return true;
+        case 5: harrisFromGradients<5>(ix, ixStep, iy, iyStep, rows, cols, k, dst, dstStep, yBegin, yEnd, scratch); return true;
+        case 7: harrisFromGradients<7>(ix, ixStep, iy, iyStep, rows, cols, k, dst, dstStep, yBegin, yEnd, scratch); return true;
+        default: return false;
+        }
+    }
+    
+    /**
+     * Hough voting: per point, the rho bins of all angles are computed first
+     * (a loop without dependencies the compiler can vectorize), then counted.
+     * Same arithmetic as evaluating x*cos + y*sin per vote.
+     * 
+     * @param votes numRhos x numAngles accumulator, voteStep ints per row
+     * @param bins numAngles ints
+     */
+    inline void houghVote(const int* xs, const int* ys, size_t count,
+                          const double* cosTable, const double* sinTable, int numAngles,
+                          double maxDist, double rho, int* votes, int numRhos, size_t voteStep,
+                          int* bins) {
+        for (size_t i = 0; i < count; i++) {
+            const double x = xs[i];
+            const double y = ys[i];
+            
+            for (int t = 0; t < numAngles; t++) {
+                double r = x * cosTable[t] + y * sinTable[t];
+                bins[t] = static_cast<int>(::round((r + maxDist) / rho));
+            }
+            
+            for (int t = 0; t < numAngles; t++) {
+                if (bins[t] >= 0 && bins[t] < numRhos) {
+                    votes[bins[t] * voteStep + t]++;
+                }
+            }
+        }
+    }
+    
+    /**
+     * Strict local maxima of one response row. Ties go to the first pixel in
+     * scan order.
+     * 
+     * @param xs Output x coordinates (at most xEnd - xBegin)
+     * @return Number of maxima written to xs
+     */
+    inline int localMaximaRow(const float* response, size_t step, int y, int xBegin, int xEnd,
+                              float threshold, int radius, int* xs) {
+        const float* row = response + y * step;
+        int count = 0;
+        
+        for (int x = xBegin; x < xEnd; x++) {
+            float v = row[x];
+            if (v <= threshold) continue;
+            
+            bool isMax = true;
+            for (int dy = -radius; dy <= radius && isMax; dy++) {
+                const float* nRow = row + dy * static_cast<ptrdiff_t>(step);
+                for (int dx = -radius; dx <= radius; dx++) {
+                    if (dy == 0 && dx == 0) continue;
+                    float n = nRow[x + dx];
+                    // On plateaus only the first pixel in scan order survives
+                    bool before = dy < 0 || (dy == 0 && dx < 0);
+                    if (n > v || (n == v && before)) {
+                        isMax = false;
+                        break;
+                    }
+                }
+            }
+            
+            if (isMax) {
+                xs[count++] = x;
+            }
+        }
+        return count;
+    }
+}
+}
+
+namespace dispatch {
+namespace CUSTOM_CV_KERNEL_NS {
+    // Constant-initialized: no guard or constructor code in the variant TU
+    static const KernelTable table = {
+        CUSTOM_CV_KERNEL_STR(CUSTOM_CV_KERNEL_NS),
+        kernels::CUSTOM_CV_KERNEL_NS::sobelRows,
+        kernels::CUSTOM_CV_KERNEL_NS::harrisRows,
+        kernels::CUSTOM_CV_KERNEL_NS::houghVote,
+        kernels::CUSTOM_CV_KERNEL_NS::localMaximaRow
+    };
+    
+    const KernelTable& kernelTable() {
+        return table;
+    }
+}
+}
+}
\ No newline at end of file
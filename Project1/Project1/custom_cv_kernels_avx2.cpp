@@ -0,0 +1,4 @@
+// Kernels built with /arch:AVX2 (see Project1.vcxproj); selected only on CPUs with AVX2 and FMA3
+// Same scalar source as the baseline, auto-vectorized for this instruction set
+#define CUSTOM_CV_KERNEL_NS avx2
+#include "custom_cv_kernels.h"
\ No newline at end of file
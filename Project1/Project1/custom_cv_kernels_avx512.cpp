@@ -0,0 +1,4 @@
+// Kernels built with /arch:AVX512 (see Project1.vcxproj); selected only on CPUs with AVX-512 F/CD/BW/DQ/VL
+// Same scalar source as the baseline, auto-vectorized for this instruction set
+#define CUSTOM_CV_KERNEL_NS avx512
+#include "custom_cv_kernels.h"
\ No newline at end of file
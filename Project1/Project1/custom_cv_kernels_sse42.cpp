@@ -0,0 +1,4 @@
+// Kernels built with /arch:SSE4.2 (see Project1.vcxproj); selected only on CPUs with SSE4.2 and POPCNT
+// Same scalar source as the baseline, auto-vectorized for this instruction set
+#define CUSTOM_CV_KERNEL_NS sse42
+#include "custom_cv_kernels.h"
\ No newline at end of file
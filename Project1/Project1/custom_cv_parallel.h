@@ -0,0 +1,29 @@
+#pragma once
+#include <opencv2/opencv.hpp>
+
+namespace custom_cv {
+
+    /**
+     * cv::parallel_for_ over a lambda without the std::function that OpenCV's
+     * lambda overload wraps it in. That wrapper heap-allocates once the
+     * captures outgrow its small-object buffer, so every call would allocate;
+     * here the body is only referenced for the duration of the loop.
+     */
+    template<typename Body>
+    class LoopBodyRef : public cv::ParallelLoopBody {
+    public:
+        explicit LoopBodyRef(const Body& body) : body(body) {}
+        
+        void operator()(const cv::Range& range) const override {
+            body(range);
+        }
+        
+    private:
+        const Body& body;
+    };
+    
+    template<typename Body>
+    inline void parallelFor(const cv::Range& range, const Body& body, double nstripes = -1.) {
+        cv::parallel_for_(range, LoopBodyRef<Body>(body), nstripes);
+    }
+}
@@ -0,0 +1,131 @@
+#include "custom_cv_trace.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace custom_cv {
+namespace trace {
+
+std::atomic<bool> enabledFlag(false);
+
+namespace {
+
+    const size_t RING_CAPACITY = 1 << 14;   // Spans kept per thread (power of two)
+    
+    struct Span {
+        const char* name;
+        int64_t beginNs;
+        int64_t endNs;
+    };
+    
+    // Written only by its owning thread; readers see the last min(written, capacity)
+    // spans through the release/acquire pair on the counter
+    struct ThreadRing {
+        explicit ThreadRing(int id) : threadId(id), spans(RING_CAPACITY), written(0) {}
+        
+        int threadId;
+        std::vector<Span> spans;
+        std::atomic<uint64_t> written;
+    };
+    
+    // Rings outlive their threads so spans of finished workers can still be exported
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::shared_ptr<ThreadRing>> rings;
+    };
+    
+    Registry& registry() {
+        static Registry instance;
+        return instance;
+    }
+    
+    ThreadRing& localRing() {
+        thread_local std::shared_ptr<ThreadRing> ring;
+        if (!ring) {
+            // Only the first span of a thread takes the lock
+            Registry& reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            ring = std::make_shared<ThreadRing>(static_cast<int>(reg.rings.size()) + 1);
+            reg.rings.push_back(ring);
+        }
+        return *ring;
+    }
+}
+
+void setEnabled(bool enabled) {
+    enabledFlag.store(enabled, std::memory_order_relaxed);
+}
+
+int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void record(const char* name, int64_t beginNs, int64_t endNs) {
+    ThreadRing& ring = localRing();
+    uint64_t index = ring.written.load(std::memory_order_relaxed);
+    Span& span = ring.spans[index & (RING_CAPACITY - 1)];
+    span.name = name;
+    span.beginNs = beginNs;
+    span.endNs = endNs;
+    ring.written.store(index + 1, std::memory_order_release);
+}
+
+void clear() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto& ring : reg.rings) {
+        ring->written.store(0, std::memory_order_release);
+    }
+}
+
+bool exportChromeTrace(const std::string& path) {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    
+    // Timestamps relative to the earliest kept span, in microseconds
+    int64_t originNs = INT64_MAX;
+    for (const auto& ring : reg.rings) {
+        uint64_t written = ring->written.load(std::memory_order_acquire);
+        uint64_t first = written > RING_CAPACITY ? written - RING_CAPACITY : 0;
+        for (uint64_t i = first; i < written; i++) {
+            originNs = std::min(originNs, ring->spans[i & (RING_CAPACITY - 1)].beginNs);
+        }
+    }
+    
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    bool firstEvent = true;
+    for (const auto& ring : reg.rings) {
+        uint64_t written = ring->written.load(std::memory_order_acquire);
+        if (written == 0) continue;
+        uint64_t first = written > RING_CAPACITY ? written - RING_CAPACITY : 0;
+        
+        out << (firstEvent ? "" : ",\n")
+            << "  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << ring->threadId
+            << ", \"args\": {\"name\": \"custom_cv thread " << ring->threadId << "\"}}";
+        firstEvent = false;
+        
+        for (uint64_t i = first; i < written; i++) {
+            const Span& span = ring->spans[i & (RING_CAPACITY - 1)];
+            out << ",\n  {\"name\": \"" << span.name << "\", \"cat\": \"custom_cv\", \"ph\": \"X\""
+                << ", \"pid\": 1, \"tid\": " << ring->threadId
+                << ", \"ts\": " << (span.beginNs - originNs) / 1000.0
+                << ", \"dur\": " << (span.endNs - span.beginNs) / 1000.0 << "}";
+        }
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+}
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Build with CUSTOM_CV_TRACE=0 to compile every trace span out of the library
+#ifndef CUSTOM_CV_TRACE
+#define CUSTOM_CV_TRACE 1
+#endif
+
+namespace custom_cv {
+namespace trace {
+
+    /**
+     * Scoped timing spans for the stages of the detection pipelines.
+     * Every thread records into its own fixed-size ring buffer (no locks on the
+     * recording path; the oldest spans are overwritten once a ring is full) and
+     * the collected spans can be written as Chrome trace JSON, viewable in
+     * chrome://tracing or Perfetto. Recording is off until setEnabled(true);
+     * while off, a span costs one relaxed atomic load.
+     */
+    
+    /**
+     * Turn span recording on or off at runtime
+     */
+    void setEnabled(bool enabled);
+    
+    extern std::atomic<bool> enabledFlag;     // Use setEnabled/isEnabled
+    
+    inline bool isEnabled() {
+        return enabledFlag.load(std::memory_order_relaxed);
+    }
+    
+    /**
+     * Drop all recorded spans of every thread
+     */
+    void clear();
+    
+    /**
+     * Write the recorded spans as Chrome trace JSON ("X" complete events).
+     * Call it while no traced function is running, otherwise spans recorded
+     * during the export may be missing or torn.
+     *
+     * @param path Output file
+     * @return false if the file could not be written
+     */
+    bool exportChromeTrace(const std::string& path);
+    
+    /**
+     * Monotonic clock used for the spans (nanoseconds)
+     */
+    int64_t nowNs();
+    
+    /**
+     * Append one finished span to the calling thread's ring
+     *
+     * @param name Stage name, must have static storage duration
+     */
+    void record(const char* name, int64_t beginNs, int64_t endNs);
+    
+    /**
+     * Records the time between construction and destruction as one span
+     */
+    class Scope {
+    public:
+        explicit Scope(const char* name) : name(name), beginNs(isEnabled() ? nowNs() : -1) {}
+        ~Scope() {
+            if (beginNs >= 0) record(name, beginNs, nowNs());
+        }
+        
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    
+    private:
+        const char* name;
+        int64_t beginNs;        // -1 when tracing was off at construction
+    };
+    
+    /**
+     * Span that also adds its duration to a caller's counter (a stats field).
+     * The counter is updated even when recording is off or compiled out;
+     * with neither a counter nor recording the clock is never read.
+     */
+    class StageScope {
+    public:
+        StageScope(const char* name, int64_t* elapsedNs)
+            : name(name), elapsedNs(elapsedNs),
+              beginNs((elapsedNs || (CUSTOM_CV_TRACE && isEnabled())) ? nowNs() : -1) {}
+        ~StageScope() {
+            if (beginNs < 0) return;
+            int64_t endNs = nowNs();
+            if (elapsedNs) *elapsedNs += endNs - beginNs;
+            if (CUSTOM_CV_TRACE && isEnabled()) record(name, beginNs, endNs);
+        }
+        
+        StageScope(const StageScope&) = delete;
+        StageScope& operator=(const StageScope&) = delete;
+        
+    private:
+        const char* name;
+        int64_t* elapsedNs;
+        int64_t beginNs;
+    };
+}
+}
+
+#define CUSTOM_CV_TRACE_CONCAT_(a, b) a##b
+#define CUSTOM_CV_TRACE_CONCAT(a, b) CUSTOM_CV_TRACE_CONCAT_(a, b)
+
+#if CUSTOM_CV_TRACE
+#define CUSTOM_CV_TRACE_SCOPE(name) \
+    custom_cv::trace::Scope CUSTOM_CV_TRACE_CONCAT(customCvTraceScope_, __LINE__)(name)
+#else
+#define CUSTOM_CV_TRACE_SCOPE(name) ((void)0)
+#endif
+
+// Stage span feeding an optional int64_t* counter; the counter survives CUSTOM_CV_TRACE=0
+#define CUSTOM_CV_STAGE_SCOPE(name, elapsedNs) \
+    custom_cv::trace::StageScope CUSTOM_CV_TRACE_CONCAT(customCvStageScope_, __LINE__)(name, elapsedNs)
@@ -82,14 +82,18 @@ int main() {
         std::vector<cv::Vec2f> lines_opencv_low;
         cv::HoughLines(src_edge, lines_opencv_low, 1, CV_PI / 180, 80);
         
-        // Custom (수정된 threshold)
+        // Custom (수정된 threshold, OpenCV와 같은 에지 입력으로 HoughLines만 비교)
         std::vector<cv::Vec2f> lines_custom;
-        custom_cv::HoughLines(src_edge, lines_custom, 1, CV_PI / 180.0, 80);
+        custom_cv::HoughStats hough_stats;
+        custom_cv::HoughLines(src_edge, lines_custom, 1, CV_PI / 180.0, 80, &hough_stats);
         
         std::cout << "📊 결과:" << std::endl;
         std::cout << "   OpenCV (threshold=400): " << std::setw(2) << lines_opencv_orig.size() << "개" << std::endl;
         std::cout << "   OpenCV (threshold=80):  " << std::setw(2) << lines_opencv_low.size() << "개" << std::endl;
         std::cout << "   Custom  (threshold=80): " << std::setw(2) << lines_custom.size() << "개" << std::endl;
+        std::cout << "   (에지 " << hough_stats.edgePixels << "화소, 후보 " << hough_stats.candidatePeaks
+                  << ", 중복 제거 " << hough_stats.suppressedDuplicates << ", 투표 "
+                  << std::fixed << std::setprecision(2) << hough_stats.voteNs / 1e6 << " ms)" << std::endl;
         
         if (lines_custom.size() > 0 && lines_opencv_low.size() > 0) {
             double ratio = (double)lines_custom.size() / lines_opencv_low.size() * 100.0;
@@ -119,7 +123,8 @@ int main() {
         
         // Custom (원본)
         cv::Mat R_custom;
-        custom_cv::cornerHarris(shapes_src, R_custom, blockSize, kSize, k);
+        custom_cv::HarrisStats harris_stats;
+        custom_cv::cornerHarris(shapes_src, R_custom, blockSize, kSize, k, cv::BORDER_DEFAULT, &harris_stats);
         cv::threshold(R_custom, R_custom, 0.02, 0, cv::THRESH_TOZERO);
         std::vector<cv::Point> corners_custom = FindLocalExtrema(R_custom);
         
@@ -133,6 +138,9 @@ int main() {
         std::cout << "   OpenCV:                " << std::setw(2) << corners_opencv.size() << "개" << std::endl;
         std::cout << "   Custom (기본):         " << std::setw(2) << corners_custom.size() << "개" << std::endl;
         std::cout << "   Custom (Enhanced):     " << std::setw(2) << corners_enhanced.size() << "개" << std::endl;
+        std::cout << "   (Custom 필터 후 응답 범위: [" << harris_stats.minResponse << ", "
+                  << harris_stats.maxResponse << "], 임계값 통과 " << harris_stats.pixelsAboveThreshold
+                  << "화소)" << std::endl;
         
         // 회전된 도형에서의 성능 분석
         auto count_rotated = [](const std::vector<cv::Point>& corners) {
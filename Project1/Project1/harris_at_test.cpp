@@ -0,0 +1,106 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include "opencv2/opencv.hpp"
+#include "custom_cv.h"
+#include "synthetic_workload.h"
+
+// cornerHarrisAt 검증: 점별 응답이 cornerHarrisResponse의 같은 화소 값과 같은지 확인
+// 사용법: harris_at_test
+//
+// 판정 기준
+//  - 짝수 blockSize (2, 4)를 포함한 모든 설정에서 최대 오차가 최대 |응답|의 TOLERANCE배 이하
+//    (조밀 경로는 filter2D / 특화 커널이라 float 합산 순서만 다름)
+//  - 영상 네 변의 화소를 모두 포함 (BORDER_REFLECT_101과 창 anchor 확인)
+
+static const double TOLERANCE = 1e-4;
+static const int GRID_STEP = 5;
+
+struct Config {
+    cv::Size size;
+    int blockSize;
+    int ksize;
+};
+
+static bool runConfig(const Config& cfg) {
+    const double k = 0.04;
+    synthetic::WorkloadSpec spec;
+    spec.size = cfg.size;
+    spec.numLines = 6;
+    spec.numCorners = 12;
+    spec.rotationDeg = 10.0;
+    spec.noiseSigma = 3.0;
+    cv::Mat image;
+    synthetic::GroundTruth gt;
+    synthetic::generate(spec, image, gt);
+
+    // 조밀 응답
+    cv::Mat R;
+    custom_cv::HarrisWorkspace ws;
+    custom_cv::cornerHarrisResponse(image, R, cfg.blockSize, cfg.ksize, k, ws);
+    double minVal, maxVal;
+    cv::minMaxLoc(R, &minVal, &maxVal);
+    double scale = std::max(std::abs(minVal), std::abs(maxVal));
+
+    // 격자 화소 + 네 변의 모든 화소
+    std::vector<cv::Point> points;
+    for (int y = 0; y < image.rows; y++) {
+        for (int x = 0; x < image.cols; x++) {
+            bool border = x == 0 || y == 0 || x == image.cols - 1 || y == image.rows - 1;
+            if (border || (x % GRID_STEP == 0 && y % GRID_STEP == 0)) {
+                points.push_back(cv::Point(x, y));
+            }
+        }
+    }
+
+    std::vector<float> responses;
+    custom_cv::cornerHarrisAt(image, points, responses, cfg.blockSize, cfg.ksize, k);
+
+    double maxError = 0;
+    cv::Point worst;
+    for (size_t i = 0; i < points.size(); i++) {
+        double error = std::abs(responses[i] - R.at<float>(points[i]));
+        if (error > maxError) {
+            maxError = error;
+            worst = points[i];
+        }
+    }
+
+    double relative = scale > 0 ? maxError / scale : maxError;
+    bool ok = relative <= TOLERANCE;
+    std::cout << std::left << std::setw(10) << (std::to_string(cfg.size.width) + "x" + std::to_string(cfg.size.height))
+              << " block=" << cfg.blockSize << " ksize=" << cfg.ksize
+              << std::right << "  점 " << std::setw(6) << points.size()
+              << "  최대 상대 오차 " << std::scientific << std::setprecision(2) << relative << std::defaultfloat
+              << " @ (" << worst.x << ", " << worst.y << ")"
+              << "  " << (ok ? "✅" : "❌") << std::endl;
+    return ok;
+}
+
+int main() {
+    std::vector<Config> configs;
+    const cv::Size sizes[] = { cv::Size(320, 240), cv::Size(97, 61) };
+    for (const auto& size : sizes) {
+        for (int blockSize : { 2, 3, 4, 5, 7 }) {
+            for (int ksize : { 3, 5 }) {
+                configs.push_back({ size, blockSize, ksize });
+            }
+        }
+    }
+
+    std::cout << "=== cornerHarrisAt vs cornerHarrisResponse ===" << std::endl;
+    int failures = 0;
+    for (const auto& cfg : configs) {
+        if (!runConfig(cfg)) failures++;
+    }
+
+    if (failures > 0) {
+        std::cout << std::endl << "❌ " << failures << "개 설정에서 점별 응답이 조밀 응답과 다릅니다" << std::endl;
+        return 1;
+    }
+    std::cout << std::endl << "✅ 점별 응답이 조밀 응답과 같습니다 (짝수 blockSize 포함)" << std::endl;
+    return 0;
+}
@@ -63,6 +63,31 @@ std::vector<cv::Point> FindLocalExtrema(cv::Mat& src)
     return points;
 }
 
+// custom_cv ֿܼ  Ƿ  𿡼 
+void PrintHoughStats(const custom_cv::HoughStats& stats, int threshold)
+{
+    std::cout << "Found " << stats.linesFound << " lines with threshold " << threshold << std::endl;
+    std::cout << "   ȭ " << stats.edgePixels << ", ǥ " << stats.votesCast
+              << ",  迭 " << stats.accumulatorSize.width << "x" << stats.accumulatorSize.height
+              << ", ĺ " << stats.candidatePeaks << ", 밢  " << stats.rejectedDiagonal
+              << ", ߺ  " << stats.suppressedDuplicates << std::endl;
+    std::cout << "   " << stats.collectNs / 1e6 << " ms, ǥ " << stats.voteNs / 1e6
+              << " ms, ũ " << stats.peakNs / 1e6 << " ms,  " << stats.filterNs / 1e6 << " ms" << std::endl;
+}
+
+void PrintHarrisStats(const custom_cv::HarrisStats& stats)
+{
+    std::cout << "Harris corner detection completed. Filtered response range: ["
+              << "min=" << stats.minResponse << ", max=" << stats.maxResponse << "]" << std::endl;
+    std::cout << "  Ӱ谪  " << stats.pixelsAboveThreshold << "ȭ,   "
+              << stats.pixelsAfterMorphology << "ȭ" << (stats.fused ? " (fused kernel)" : "") << std::endl;
+    std::cout << "  ȯ " << stats.convertNs / 1e6 << " ms, Sobel " << stats.sobelNs / 1e6
+              << " ms,  " << stats.productsNs / 1e6 << " ms,  " << stats.windowNs / 1e6
+              << " ms,  " << stats.responseNs / 1e6 << " ms" << std::endl;
+    std::cout << "  Ӱ谪 " << stats.thresholdNs / 1e6 << " ms,  " << stats.morphologyNs / 1e6
+              << " ms, ȭ " << stats.normalizeNs / 1e6 << " ms" << std::endl;
+}
+
 int run_HoughLines_Original()
 {
     cv::Mat src = cv::imread("./images/lg_building.jpg", cv::IMREAD_GRAYSCALE);
@@ -119,12 +144,19 @@ int run_HoughLines_Custom()
     cv::Mat src_out;
     cvtColor(src, src_out, cv::COLOR_GRAY2BGR);
 
-    cv::Mat src_edge;
-    cv::Canny(src, src_edge, 170, 200);
+    // ü Canny:  Ʈ HoughLines ٷ  (dense Ž )
+    custom_cv::EdgeList edgeList;
+    custom_cv::Canny(src, edgeList, 170, 200);
 
+    cv::Mat src_edge = cv::Mat::zeros(src.size(), CV_8UC1);
+    for (size_t i = 0; i < edgeList.size(); i++) {
+        src_edge.at<uchar>(edgeList.y[i], edgeList.x[i]) = 255;
+    }
 
     std::vector<cv::Vec2f> lines;
-    custom_cv::HoughLines(src_edge, lines, 1, CV_PI / 180.0, 80);  // ȭ threshold
+    custom_cv::HoughStats houghStats;
+    custom_cv::HoughLines(edgeList, lines, 1, CV_PI / 180.0, 80, &houghStats);  // ȭ threshold
+    PrintHoughStats(houghStats, 80);
 
     std::cout << "Custom HoughLines : " << lines.size() << "  " << std::endl;
 
@@ -206,7 +238,9 @@ int run_HarrisCornerDetector_Custom()
     double k = 0.01;
 
     cv::Mat R;
-    custom_cv::cornerHarris(src, R, blockSize, kSize, k);
+    custom_cv::HarrisStats harrisStats;
+    custom_cv::cornerHarris(src, R, blockSize, kSize, k, cv::BORDER_DEFAULT, &harrisStats);
+    PrintHarrisStats(harrisStats);
     cv::threshold(R, R, 0.02, 0, cv::THRESH_TOZERO);
 
     std::vector<cv::Point> cornerPoints = FindLocalExtrema(R);
@@ -249,7 +283,9 @@ int run_HarrisCornerDetector_Enhanced()
     std::cout << "Enhanced Harris Corner Detection  ..." << std::endl;
 
     cv::Mat R;
-    custom_cv::cornerHarris(src, R, blockSize, kSize, k);
+    custom_cv::HarrisStats harrisStats;
+    custom_cv::cornerHarris(src, R, blockSize, kSize, k, cv::BORDER_DEFAULT, &harrisStats);
+    PrintHarrisStats(harrisStats);
     cv::threshold(R, R, 0.015, 0, cv::THRESH_TOZERO);  //   threshold
 
     // Enhanced FindLocalExtrema 
@@ -277,6 +313,75 @@ int run_HarrisCornerDetector_Enhanced()
     return 0;
 }
 
+int run_FrameAnalyzer()
+{
+    cv::Mat src = cv::imread("./images/lg_building.jpg", cv::IMREAD_GRAYSCALE);
+    if (src.empty()) {
+        std::cerr << "̹ ҷ  ϴ." << std::endl;
+        return -1;
+    }
+
+    const int iterations = 10;
+    custom_cv::FrameAnalyzerParams params;
+
+    // ܰ躰 : Canny, HoughLines, cornerHarris  ׷Ʈ 
+    cv::Mat edges, R;
+    std::vector<cv::Vec2f> lines;
+    int64 start = cv::getTickCount();
+    for (int i = 0; i < iterations; i++) {
+        cv::Canny(src, edges, params.cannyLow, params.cannyHigh, params.ksize, false);
+        custom_cv::HoughLines(edges, lines, params.rho, params.theta, params.houghThreshold);
+        custom_cv::cornerHarris(src, R, params.blockSize, params.ksize, params.k);
+    }
+    double separateMs = (cv::getTickCount() - start) * 1000.0 / cv::getTickFrequency() / iterations;
+
+    //  : Ix/Iy   Ͽ  Harris 
+    custom_cv::FrameAnalyzer analyzer(params);
+    cv::Mat sharedEdges, sharedR;
+    std::vector<cv::Vec2f> sharedLines;
+    start = cv::getTickCount();
+    for (int i = 0; i < iterations; i++) {
+        analyzer.analyze(src, sharedEdges, sharedLines, sharedR);
+    }
+    double sharedMs = (cv::getTickCount() - start) * 1000.0 / cv::getTickFrequency() / iterations;
+
+    std::cout << "ܰ躰 : " << separateMs << " ms/frame,  " << lines.size() << "" << std::endl;
+    std::cout << " : " << sharedMs << " ms/frame,  " << sharedLines.size() << "" << std::endl;
+
+    cv::Mat dst;
+    cvtColor(src, dst, cv::COLOR_GRAY2BGR);
+    for (size_t i = 0; i < sharedLines.size(); i++) {
+        float rho = sharedLines[i][0], theta = sharedLines[i][1];
+        cv::Point pt1, pt2;
+        double x0 = rho * cos(theta), y0 = rho * sin(theta);
+        pt1.x = round(x0 + 1000 * (-sin(theta)));
+        pt1.y = round(y0 + 1000 * (cos(theta)));
+        pt2.x = round(x0 - 1000 * (-sin(theta)));
+        pt2.y = round(y0 - 1000 * (cos(theta)));
+
+        cv::line(dst, pt1, pt2, cv::Scalar(0, 0, 255), 2, 8);
+    }
+
+    cv::threshold(sharedR, sharedR, 0.02, 0, cv::THRESH_TOZERO);
+    std::vector<cv::Point> cornerPoints = FindLocalExtrema(sharedR);
+    for (const auto& c : cornerPoints) {
+        cv::circle(dst, c, 5, cv::Scalar(0, 255, 0), 2);
+    }
+    std::cout << "  ڳ: " << cornerPoints.size() << " " << std::endl;
+
+    try {
+        cv::imshow("Shared Edge Image", sharedEdges);
+        cv::imshow("Lines + Corners", dst);
+        cv::waitKey(0);
+        cv::destroyAllWindows();
+    }
+    catch (const cv::Exception& e) {
+        std::cout << "÷  Ұ,  մϴ." << std::endl;
+    }
+
+    return 0;
+}
+
 int main()
 {
     std::cout << "Computer Vision Assignment -  " << std::endl;
@@ -292,6 +397,7 @@ int main()
         std::cout << "5. Enhanced cornerHarris  (ȸ  ȭ)" << std::endl;
         std::cout << "6. Hough Lines  (OpenCV vs Custom)" << std::endl;
         std::cout << "7. Harris Corners  (OpenCV vs Custom vs Enhanced)" << std::endl;
+        std::cout << "8.   (Hough + Harris ׷Ʈ )" << std::endl;
         std::cout << "0. " << std::endl;
         std::cout << ": ";
 
@@ -324,6 +430,9 @@ int main()
             run_HarrisCornerDetector_Custom();
             run_HarrisCornerDetector_Enhanced();
             break;
+        case 8:
+            run_FrameAnalyzer();
+            break;
         case 0:
             std::cout << "α׷ մϴ..." << std::endl;
             return 0;
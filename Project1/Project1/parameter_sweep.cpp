@@ -0,0 +1,487 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <functional>
+#include <cstdlib>
+#include <cmath>
+#include "opencv2/opencv.hpp"
+#include "custom_cv.h"
+#include "custom_cv_dispatch.h"
+#include "synthetic_workload.h"
+
+// 정확도/속도 파라미터 스윕: create_test_images --set 으로 만든 합성 영상 세트를 읽어
+// custom_cv의 각 엔진/모드별로 검출 파라미터를 바꿔 가며 시간과 recall을 측정하고
+// 영상 크기별 Pareto front (더 빠르면서 recall이 같거나 높은 설정이 없는 점)를 보고
+// 사용법: parameter_sweep <manifest.txt> [--out sweep_results.json] [--reps N] [--max-mp X]
+
+const double LINE_RHO_TOLERANCE = 3.0;                  // 화소
+const double LINE_THETA_TOLERANCE = 2.0 * CV_PI / 180;  // 라디안
+const double CORNER_TOLERANCE = 3.0;                    // 화소
+const double HOUGH_AXIS_WINDOW_DEG = 15.0;              // custom_cv::HoughLines는 수평/수직 ±15도 안의 직선만 보고
+
+struct SweepConfig {
+    std::string manifestPath;
+    std::string outPath = "sweep_results.json";
+    int reps = 3;
+    double maxMegapixels = 1e9;
+};
+
+struct SweepPoint {
+    std::string task;           // "lines", "lines_oblique" (custom_cv::HoughLines 범위 밖 각도) 또는 "corners"
+    std::string engine;
+    std::string param;          // 스윕한 파라미터 (사람이 읽는 형태)
+    double paramValue;
+    cv::Size size;
+    double medianMs;
+    double recall;
+    double precision;
+    int detections;
+    bool pareto;                // 같은 엔진 안에서의 Pareto front
+    bool globalPareto;          // 모든 엔진을 합친 Pareto front
+};
+
+// 1회 워밍업 후 reps회 실행 시간의 중앙값 (ms)
+static double medianTime(int reps, const std::function<void()>& fn) {
+    std::vector<double> samples;
+    fn();
+    for (int i = 0; i < reps; i++) {
+        int64 start = cv::getTickCount();
+        fn();
+        samples.push_back((cv::getTickCount() - start) * 1000.0 / cv::getTickFrequency());
+    }
+    std::sort(samples.begin(), samples.end());
+    size_t n = samples.size();
+    return n % 2 ? samples[n / 2] : 0.5 * (samples[n / 2 - 1] + samples[n / 2]);
+}
+
+// custom_cv::HoughLines가 보고할 수 있는 각도인지 (theta가 0, 90, 180도에서 HOUGH_AXIS_WINDOW_DEG 미만)
+static bool houghSupportsAngle(double theta) {
+    double deg = theta * 180.0 / CV_PI;
+    return deg < HOUGH_AXIS_WINDOW_DEG || std::abs(deg - 90.0) < HOUGH_AXIS_WINDOW_DEG ||
+           std::abs(deg - 180.0) < HOUGH_AXIS_WINDOW_DEG;
+}
+
+// 직선 매칭: 정답 직선마다 허용 오차 안에 검출이 하나라도 있으면 recall,
+// 어떤 정답에도 가깝지 않은 검출은 오검출
+static void scoreLines(const std::vector<cv::Vec2f>& detected, const synthetic::GroundTruth& gt,
+                       double& recall, double& precision) {
+    std::vector<bool> found(gt.lines.size(), false);
+    int truePositives = 0;
+    for (const auto& d : detected) {
+        bool matched = false;
+        for (size_t i = 0; i < gt.lines.size(); i++) {
+            double dRho, dTheta;
+            synthetic::lineDistance(gt.lines[i], d, dRho, dTheta);
+            if (dRho <= LINE_RHO_TOLERANCE && dTheta <= LINE_THETA_TOLERANCE) {
+                found[i] = true;
+                matched = true;
+            }
+        }
+        if (matched) truePositives++;
+    }
+    int hits = static_cast<int>(std::count(found.begin(), found.end(), true));
+    recall = gt.lines.empty() ? 1.0 : static_cast<double>(hits) / gt.lines.size();
+    precision = detected.empty() ? 1.0 : static_cast<double>(truePositives) / detected.size();
+}
+
+// 코너 매칭: 직선 교차점 근처의 검출은 실제 코너이므로 오검출로 세지 않음
+static void scoreCorners(const std::vector<cv::Point2f>& detected, const synthetic::GroundTruth& gt,
+                         double& recall, double& precision) {
+    const double tol2 = CORNER_TOLERANCE * CORNER_TOLERANCE;
+    auto within = [tol2](const cv::Point2f& a, const cv::Point2f& b) {
+        double dx = a.x - b.x, dy = a.y - b.y;
+        return dx * dx + dy * dy <= tol2;
+    };
+
+    std::vector<bool> found(gt.corners.size(), false);
+    int truePositives = 0, counted = 0;
+    for (const auto& d : detected) {
+        bool matched = false;
+        for (size_t i = 0; i < gt.corners.size(); i++) {
+            if (within(gt.corners[i], d)) {
+                found[i] = true;
+                matched = true;
+            }
+        }
+        if (matched) {
+            truePositives++;
+            counted++;
+            continue;
+        }
+        bool atJunction = false;
+        for (const auto& j : gt.junctions) {
+            if (within(j, d)) { atJunction = true; break; }
+        }
+        if (!atJunction) counted++;
+    }
+    int hits = static_cast<int>(std::count(found.begin(), found.end(), true));
+    recall = gt.corners.empty() ? 1.0 : static_cast<double>(hits) / gt.corners.size();
+    precision = counted == 0 ? 1.0 : static_cast<double>(truePositives) / counted;
+}
+
+static std::vector<cv::Point2f> toPoints(const std::vector<cv::Point>& points) {
+    return std::vector<cv::Point2f>(points.begin(), points.end());
+}
+
+static std::vector<cv::Point2f> toPoints(const std::vector<cv::KeyPoint>& keypoints) {
+    std::vector<cv::Point2f> points;
+    points.reserve(keypoints.size());
+    for (const auto& kp : keypoints) points.push_back(kp.pt);
+    return points;
+}
+
+static void maximaAboveRelative(const cv::Mat& response, std::vector<cv::Point>& peaks, double fraction) {
+    double maxVal = 0;
+    cv::minMaxLoc(response, nullptr, &maxVal);
+    custom_cv::findLocalMaxima(response, peaks, static_cast<float>(maxVal * fraction));
+}
+
+// 직선 검출 스윕: Hough 누적 임계값을 영상 짧은 변 길이의 비율로 지정
+static void sweepLines(const cv::Mat& image, const synthetic::GroundTruth& gt, int reps,
+                       std::vector<SweepPoint>& points) {
+    const double cannyLow = 50, cannyHigh = 150;
+    const int minSide = std::min(image.cols, image.rows);
+    const double fractions[] = { 0.1, 0.2, 0.4, 0.8 };
+
+    // custom_cv 엔진이 검출할 수 없는 각도의 직선이 있는 영상은 별도 task로 집계
+    // (recall 0이 수평/수직 영상의 평균과 Pareto front에 섞이지 않게)
+    bool supported = std::all_of(gt.lines.begin(), gt.lines.end(), [](const cv::Vec2f& line) {
+        return houghSupportsAngle(line[1]);
+    });
+    const std::string task = supported ? "lines" : "lines_oblique";
+
+    cv::Mat edges;
+    custom_cv::EdgeList edgeList;
+    custom_cv::CannyWorkspace cannyWs;
+    custom_cv::FrameAnalyzerParams analyzerParams;
+    analyzerParams.cannyLow = cannyLow;
+    analyzerParams.cannyHigh = cannyHigh;
+
+    for (double fraction : fractions) {
+        int threshold = std::max(1, static_cast<int>(fraction * minSide));
+        analyzerParams.houghThreshold = threshold;
+        custom_cv::FrameAnalyzer analyzer(analyzerParams);
+        cv::Mat harris;
+
+        struct Engine {
+            std::string name;
+            std::function<void(std::vector<cv::Vec2f>&)> run;
+        };
+        std::vector<Engine> engines = {
+            { "cv::Canny + HoughLines", [&](std::vector<cv::Vec2f>& lines) {
+                cv::Canny(image, edges, cannyLow, cannyHigh);
+                custom_cv::HoughLines(edges, lines, 1, CV_PI / 180, threshold);
+            } },
+            { "Canny(EdgeList) + HoughLines", [&](std::vector<cv::Vec2f>& lines) {
+                custom_cv::Canny(image, edgeList, cannyLow, cannyHigh, cannyWs);
+                custom_cv::HoughLines(edgeList, lines, 1, CV_PI / 180, threshold);
+            } },
+            { "FrameAnalyzer", [&](std::vector<cv::Vec2f>& lines) {
+                analyzer.analyze(image, edges, lines, harris);
+            } },
+            { "opencv", [&](std::vector<cv::Vec2f>& lines) {
+                cv::Canny(image, edges, cannyLow, cannyHigh);
+                cv::HoughLines(edges, lines, 1, CV_PI / 180, threshold);
+            } },
+        };
+
+        for (const auto& engine : engines) {
+            std::vector<cv::Vec2f> lines;
+            SweepPoint p;
+            p.task = task;
+            p.engine = engine.name;
+            std::ostringstream param;
+            param << "threshold=" << fraction << "*min(w,h)";
+            p.param = param.str();
+            p.paramValue = fraction;
+            p.size = image.size();
+            p.medianMs = medianTime(reps, [&]() { engine.run(lines); });
+            scoreLines(lines, gt, p.recall, p.precision);
+            p.detections = static_cast<int>(lines.size());
+            points.push_back(p);
+        }
+    }
+}
+
+// 코너 검출 스윕: 상대 임계값 모드는 최대 응답 대비 비율, 절대 임계값 모드
+// (StreamingHarris, VideoHarris)는 [0,1] 정규화 응답 값 자체를 바꿈
+static void sweepCorners(const cv::Mat& image, const synthetic::GroundTruth& gt, int reps,
+                         std::vector<SweepPoint>& points) {
+    const int blockSize = 5, ksize = 3;
+    const double k = 0.04;
+    const double relative[] = { 0.001, 0.01, 0.05, 0.1 };
+    const double absolute[] = { 1e-6, 1e-5, 1e-4, 1e-3 };
+
+    cv::Mat response;
+    custom_cv::HarrisWorkspace ws;
+    std::vector<cv::Point> peaks;
+
+    struct Engine {
+        std::string name;
+        bool absoluteThreshold;
+        std::function<void(double, std::vector<cv::Point2f>&)> run;
+    };
+    std::vector<Engine> engines = {
+        { "cornerHarris + findLocalMaxima", false, [&](double t, std::vector<cv::Point2f>& out) {
+            custom_cv::cornerHarris(image, response, blockSize, ksize, k, ws);
+            custom_cv::findLocalMaxima(response, peaks, static_cast<float>(t));
+            out = toPoints(peaks);
+        } },
+        { "cornerHarrisResponse", false, [&](double t, std::vector<cv::Point2f>& out) {
+            custom_cv::cornerHarrisResponse(image, response, blockSize, ksize, k, ws);
+            maximaAboveRelative(response, peaks, t);
+            out = toPoints(peaks);
+        } },
+        { "cornerHarrisResponse + refineCornersSubPix", false, [&](double t, std::vector<cv::Point2f>& out) {
+            custom_cv::cornerHarrisResponse(image, response, blockSize, ksize, k, ws);
+            maximaAboveRelative(response, peaks, t);
+            custom_cv::refineCornersSubPix(response, ws, peaks, out);
+        } },
+        { "cornerHarrisFAST", false, [&](double t, std::vector<cv::Point2f>& out) {
+            custom_cv::FastHarrisParams params;
+            params.blockSize = blockSize;
+            params.ksize = ksize;
+            params.k = k;
+            params.threshold = t;
+            std::vector<cv::KeyPoint> keypoints;
+            custom_cv::cornerHarrisFAST(image, keypoints, params);
+            out = toPoints(keypoints);
+        } },
+        { "HarrisLaplaceDetector", false, [&](double t, std::vector<cv::Point2f>& out) {
+            custom_cv::HarrisLaplaceDetector detector(5, 1.4142135623730951, blockSize, ksize, k, t);
+            std::vector<cv::KeyPoint> keypoints;
+            detector.detect(image, keypoints);
+            out = toPoints(keypoints);
+        } },
+        { "StreamingHarris", true, [&](double t, std::vector<cv::Point2f>& out) {
+            custom_cv::StreamingHarris streaming(image.cols, blockSize, ksize, k, static_cast<float>(t));
+            std::vector<cv::KeyPoint> keypoints;
+            for (int y = 0; y < image.rows; y++) {
+                streaming.pushRow(image.ptr<uchar>(y), keypoints);
+            }
+            streaming.finish(keypoints);
+            out = toPoints(keypoints);
+        } },
+        { "VideoHarris (first frame)", true, [&](double t, std::vector<cv::Point2f>& out) {
+            custom_cv::VideoHarris video(64, blockSize, ksize, k, static_cast<float>(t));
+            std::vector<cv::KeyPoint> keypoints;
+            video.detect(image, keypoints);
+            out = toPoints(keypoints);
+        } },
+        { "opencv", false, [&](double t, std::vector<cv::Point2f>& out) {
+            cv::cornerHarris(image, response, blockSize, ksize, k);
+            maximaAboveRelative(response, peaks, t);
+            out = toPoints(peaks);
+        } },
+    };
+
+    for (const auto& engine : engines) {
+        const double* values = engine.absoluteThreshold ? absolute : relative;
+        for (int i = 0; i < 4; i++) {
+            double t = values[i];
+            std::vector<cv::Point2f> corners;
+            SweepPoint p;
+            p.task = "corners";
+            p.engine = engine.name;
+            std::ostringstream param;
+            param << (engine.absoluteThreshold ? "threshold=" : "threshold=max*") << t;
+            p.param = param.str();
+            p.paramValue = t;
+            p.size = image.size();
+            p.medianMs = medianTime(reps, [&]() { engine.run(t, corners); });
+            scoreCorners(corners, gt, p.recall, p.precision);
+            p.detections = static_cast<int>(corners.size());
+            points.push_back(p);
+        }
+    }
+}
+
+// 같은 그룹 안에서 시간 오름차순으로 훑으며 지금까지의 최고 recall을 넘는 점만 front에 남김
+static void markPareto(std::vector<SweepPoint*>& group, bool SweepPoint::* flag) {
+    std::sort(group.begin(), group.end(), [](const SweepPoint* a, const SweepPoint* b) {
+        if (a->medianMs != b->medianMs) return a->medianMs < b->medianMs;
+        return a->recall > b->recall;
+    });
+    double bestRecall = -1.0;
+    for (SweepPoint* p : group) {
+        p->*flag = p->recall > bestRecall;
+        if (p->*flag) bestRecall = p->recall;
+    }
+}
+
+static void computeParetoFronts(std::vector<SweepPoint>& points) {
+    std::map<std::string, std::vector<SweepPoint*>> perEngine, global;
+    for (auto& p : points) {
+        std::ostringstream key;
+        key << p.task << "|" << p.size.width << "x" << p.size.height;
+        global[key.str()].push_back(&p);
+        perEngine[key.str() + "|" + p.engine].push_back(&p);
+    }
+    for (auto& g : perEngine) markPareto(g.second, &SweepPoint::pareto);
+    for (auto& g : global) markPareto(g.second, &SweepPoint::globalPareto);
+}
+
+static std::string jsonEscape(const std::string& s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+static void writeJson(const SweepConfig& cfg, const std::vector<SweepPoint>& points) {
+    std::ofstream out(cfg.outPath);
+    if (!out) {
+        std::cerr << "결과 파일을 열 수 없습니다: " << cfg.outPath << std::endl;
+        return;
+    }
+
+    out << std::fixed << std::setprecision(4);
+    out << "{\n";
+    out << "  \"meta\": {\n";
+    out << "    \"opencv_version\": \"" << CV_VERSION << "\",\n";
+    out << "    \"cpu_variant\": \"" << custom_cv::dispatch::kernelTable().name << "\",\n";
+    out << "    \"manifest\": \"" << jsonEscape(cfg.manifestPath) << "\",\n";
+    out << "    \"reps\": " << cfg.reps << ",\n";
+    out << "    \"line_tolerance\": {\"rho_px\": " << LINE_RHO_TOLERANCE
+        << ", \"theta_deg\": " << LINE_THETA_TOLERANCE * 180 / CV_PI << "},\n";
+    out << "    \"hough_axis_window_deg\": " << HOUGH_AXIS_WINDOW_DEG << ",\n";
+    out << "    \"corner_tolerance_px\": " << CORNER_TOLERANCE << "\n";
+    out << "  },\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < points.size(); i++) {
+        const SweepPoint& p = points[i];
+        out << "    {\"task\": \"" << p.task << "\", \"engine\": \"" << jsonEscape(p.engine) << "\""
+            << ", \"param\": \"" << jsonEscape(p.param) << "\", \"param_value\": " << p.paramValue
+            << ", \"width\": " << p.size.width << ", \"height\": " << p.size.height
+            << ", \"median_ms\": " << p.medianMs << ", \"recall\": " << p.recall
+            << ", \"precision\": " << p.precision << ", \"detections\": " << p.detections
+            << ", \"pareto\": " << (p.pareto ? "true" : "false")
+            << ", \"global_pareto\": " << (p.globalPareto ? "true" : "false") << "}"
+            << (i + 1 < points.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+// 영상 크기별로 스윕 점을 모아 평균 (같은 크기의 회전/노이즈/밀도 조합 평균)
+static std::vector<SweepPoint> averageBySize(const std::vector<SweepPoint>& raw) {
+    std::map<std::string, std::vector<const SweepPoint*>> groups;
+    std::vector<std::string> order;
+    for (const auto& p : raw) {
+        std::ostringstream key;
+        key << p.task << "|" << p.engine << "|" << p.param << "|" << p.size.width << "x" << p.size.height;
+        if (!groups.count(key.str())) order.push_back(key.str());
+        groups[key.str()].push_back(&p);
+    }
+
+    std::vector<SweepPoint> averaged;
+    for (const auto& key : order) {
+        const auto& group = groups[key];
+        SweepPoint avg = *group.front();
+        avg.medianMs = avg.recall = avg.precision = 0;
+        avg.detections = 0;
+        for (const SweepPoint* p : group) {
+            avg.medianMs += p->medianMs;
+            avg.recall += p->recall;
+            avg.precision += p->precision;
+            avg.detections += p->detections;
+        }
+        double n = static_cast<double>(group.size());
+        avg.medianMs /= n;
+        avg.recall /= n;
+        avg.precision /= n;
+        avg.detections = static_cast<int>(avg.detections / n + 0.5);
+        averaged.push_back(avg);
+    }
+    return averaged;
+}
+
+int main(int argc, char** argv) {
+    SweepConfig cfg;
+    if (argc < 2) {
+        std::cerr << "사용법: parameter_sweep <manifest.txt> [--out sweep_results.json] [--reps N] [--max-mp X]" << std::endl;
+        return -1;
+    }
+    cfg.manifestPath = argv[1];
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--out" && i + 1 < argc) cfg.outPath = argv[++i];
+        else if (arg == "--reps" && i + 1 < argc) cfg.reps = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--max-mp" && i + 1 < argc) cfg.maxMegapixels = std::atof(argv[++i]);
+        else {
+            std::cerr << "알 수 없는 옵션: " << arg << std::endl;
+            return -1;
+        }
+    }
+
+    std::ifstream manifest(cfg.manifestPath);
+    if (!manifest) {
+        std::cerr << "manifest 파일을 열 수 없습니다: " << cfg.manifestPath << std::endl;
+        return -1;
+    }
+
+    std::cout << "📈 custom_cv 정확도/속도 파라미터 스윕" << std::endl;
+    std::cout << "===================================" << std::endl;
+    std::cout << "CPU variant: " << custom_cv::dispatch::kernelTable().name
+              << ", reps " << cfg.reps << std::endl;
+
+    std::vector<SweepPoint> raw;
+    std::string imagePath, truthPath;
+    while (manifest >> imagePath >> truthPath) {
+        synthetic::WorkloadSpec spec;
+        synthetic::GroundTruth gt;
+        if (!synthetic::readGroundTruth(truthPath, spec, gt)) {
+            std::cerr << "정답 파일을 읽을 수 없습니다: " << truthPath << std::endl;
+            continue;
+        }
+        if (spec.size.area() / 1e6 > cfg.maxMegapixels) continue;
+
+        cv::Mat image = cv::imread(imagePath, cv::IMREAD_GRAYSCALE);
+        if (image.empty()) {
+            std::cerr << "영상을 읽을 수 없습니다: " << imagePath << std::endl;
+            continue;
+        }
+
+        std::cout << "- " << imagePath << " (" << image.cols << "x" << image.rows << ")" << std::endl;
+        sweepLines(image, gt, cfg.reps, raw);
+        sweepCorners(image, gt, cfg.reps, raw);
+    }
+
+    if (raw.empty()) {
+        std::cerr << "측정된 영상이 없습니다." << std::endl;
+        return -1;
+    }
+
+    std::vector<SweepPoint> points = averageBySize(raw);
+    computeParetoFronts(points);
+
+    // 콘솔 보고: 크기별, 엔진별 Pareto front (* = 전체 엔진 기준으로도 front)
+    std::cout << std::fixed << std::setprecision(3);
+    std::string lastGroup;
+    for (const auto& p : points) {
+        if (!p.pareto) continue;
+        std::ostringstream group;
+        group << p.task << " @ " << p.size.width << "x" << p.size.height;
+        if (group.str() != lastGroup) {
+            std::cout << "\n[" << group.str() << "]" << std::endl;
+            std::cout << std::left << std::setw(44) << "engine" << std::setw(26) << "param"
+                      << std::right << std::setw(12) << "ms" << std::setw(9) << "recall"
+                      << std::setw(11) << "precision" << std::endl;
+            lastGroup = group.str();
+        }
+        std::cout << std::left << std::setw(44) << p.engine << std::setw(26) << p.param
+                  << std::right << std::setw(12) << p.medianMs << std::setw(9) << p.recall
+                  << std::setw(11) << p.precision << (p.globalPareto ? " *" : "") << std::endl;
+    }
+
+    writeJson(cfg, points);
+    std::cout << "\n결과 저장: " << cfg.outPath << " (" << points.size() << "개 설정)" << std::endl;
+    return 0;
+}
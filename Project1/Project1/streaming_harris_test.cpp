@@ -0,0 +1,149 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <set>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+#include "opencv2/opencv.hpp"
+#include "custom_cv.h"
+#include "synthetic_workload.h"
+
+// StreamingHarris 검증: 한 행씩 넣은 결과가 일괄 처리 결과와 같은지 확인
+// 일괄 처리 = cornerHarrisResponse + findLocalMaxima (StreamingHarris 주석의 약속)
+// 사용법: streaming_harris_test
+//
+// 판정 기준
+//  - 두 결과의 코너 위치가 모두 일치 (마지막 행 근처 포함)
+//  - 일괄 경로는 2D 창 / 특화 커널이라 float 합산 순서가 달라 응답이 아주 조금 다를 수 있음
+//    임계값이나 이웃 값과 AMBIGUOUS_TOLERANCE 이내로 붙어 있는 화소의 불일치만 허용
+//  - 아래쪽 경계 (마지막 BOTTOM_ROWS 행)에 코너가 실제로 있는 영상으로 검사
+
+static const float AMBIGUOUS_TOLERANCE = 1e-4f;     // 최대 응답 대비 비율
+static const int BOTTOM_ROWS = 8;
+
+struct Config {
+    cv::Size size;
+    int blockSize;
+    int ksize;
+};
+
+// 일괄 응답에서 (x, y)의 판정이 float 오차로 뒤집힐 수 있는지
+static bool isAmbiguous(const cv::Mat& R, int x, int y, float threshold, float tolerance) {
+    float v = R.at<float>(y, x);
+    if (std::abs(v - threshold) <= tolerance) return true;
+    for (int dy = -1; dy <= 1; dy++) {
+        for (int dx = -1; dx <= 1; dx++) {
+            int nx = x + dx, ny = y + dy;
+            if ((dx == 0 && dy == 0) || nx < 0 || ny < 0 || nx >= R.cols || ny >= R.rows) continue;
+            if (std::abs(R.at<float>(ny, nx) - v) <= tolerance) return true;
+        }
+    }
+    return false;
+}
+
+// 아래쪽 경계에 코너가 생기도록 영상 아래 끝에 걸친 사각형을 추가
+static cv::Mat makeImage(const cv::Size& size) {
+    synthetic::WorkloadSpec spec;
+    spec.size = size;
+    spec.numLines = 6;
+    spec.numCorners = 12;
+    spec.rotationDeg = 0.0;
+    spec.noiseSigma = 2.0;
+    cv::Mat image;
+    synthetic::GroundTruth gt;
+    synthetic::generate(spec, image, gt);
+
+    int side = std::max(4, std::min(size.width, size.height) / 6);
+    cv::rectangle(image, cv::Rect(size.width / 3, size.height - side / 2, side, side),
+                  cv::Scalar(synthetic::RECT_INTENSITY), cv::FILLED);
+    cv::rectangle(image, cv::Rect(2 * size.width / 3, size.height - 3, side, 2),
+                  cv::Scalar(synthetic::LINE_INTENSITY), cv::FILLED);
+    return image;
+}
+
+static bool runConfig(const Config& cfg) {
+    const double k = 0.04;
+    cv::Mat image = makeImage(cfg.size);
+
+    // 일괄 처리
+    cv::Mat R;
+    custom_cv::HarrisWorkspace ws;
+    custom_cv::cornerHarrisResponse(image, R, cfg.blockSize, cfg.ksize, k, ws);
+    double maxResponse;
+    cv::minMaxLoc(R, nullptr, &maxResponse);
+    float threshold = static_cast<float>(0.01 * maxResponse);
+    float tolerance = static_cast<float>(AMBIGUOUS_TOLERANCE * maxResponse);
+
+    std::vector<cv::Point> batchPoints;
+    custom_cv::findLocalMaxima(R, batchPoints, threshold, 1);
+
+    // 한 행씩 스트리밍
+    std::vector<cv::KeyPoint> streamed;
+    custom_cv::StreamingHarris engine(image.cols, cfg.blockSize, cfg.ksize, k, threshold);
+    for (int y = 0; y < image.rows; y++) {
+        engine.pushRow(image.ptr<uchar>(y), streamed);
+    }
+    engine.finish(streamed);
+
+    std::set<std::pair<int, int>> batchSet, streamSet;
+    for (const auto& p : batchPoints) batchSet.insert({ p.y, p.x });
+    for (const auto& kp : streamed) streamSet.insert({ cvRound(kp.pt.y), cvRound(kp.pt.x) });
+
+    int mismatches = 0, ambiguous = 0, batchBottom = 0, streamBottom = 0;
+    auto check = [&](const std::set<std::pair<int, int>>& a, const std::set<std::pair<int, int>>& b) {
+        for (const auto& p : a) {
+            if (b.count(p)) continue;
+            if (isAmbiguous(R, p.second, p.first, threshold, tolerance)) {
+                ambiguous++;
+            } else {
+                if (mismatches < 5) {
+                    std::cout << "    불일치: (" << p.second << ", " << p.first << ")"
+                              << (p.first >= image.rows - BOTTOM_ROWS ? " [아래쪽 경계]" : "") << std::endl;
+                }
+                mismatches++;
+            }
+        }
+    };
+    check(batchSet, streamSet);
+    check(streamSet, batchSet);
+    for (const auto& p : batchSet) if (p.first >= image.rows - BOTTOM_ROWS) batchBottom++;
+    for (const auto& p : streamSet) if (p.first >= image.rows - BOTTOM_ROWS) streamBottom++;
+
+    // 아래쪽 경계에 코너가 없으면 마지막 행 처리를 검사하지 못한 것
+    bool ok = mismatches == 0 && batchBottom > 0;
+    std::cout << std::left << std::setw(12) << (std::to_string(cfg.size.width) + "x" + std::to_string(cfg.size.height))
+              << " block=" << cfg.blockSize << " ksize=" << cfg.ksize
+              << std::right << "  일괄 " << std::setw(5) << batchSet.size()
+              << "  스트리밍 " << std::setw(5) << streamSet.size()
+              << "  아래쪽 " << batchBottom << "/" << streamBottom
+              << "  불일치 " << mismatches << " (경계값 " << ambiguous << ")"
+              << "  " << (ok ? "✅" : "❌") << std::endl;
+    return ok;
+}
+
+int main() {
+    std::vector<Config> configs;
+    const cv::Size sizes[] = { cv::Size(640, 480), cv::Size(333, 97), cv::Size(64, 23) };
+    for (const auto& size : sizes) {
+        for (int blockSize : { 3, 5, 7 }) {
+            for (int ksize : { 3, 5 }) {
+                configs.push_back({ size, blockSize, ksize });
+            }
+        }
+    }
+
+    std::cout << "=== StreamingHarris vs cornerHarrisResponse + findLocalMaxima ===" << std::endl;
+    int failures = 0;
+    for (const auto& cfg : configs) {
+        if (!runConfig(cfg)) failures++;
+    }
+
+    if (failures > 0) {
+        std::cout << std::endl << "❌ " << failures << "개 설정에서 스트리밍 결과가 일괄 처리와 다릅니다" << std::endl;
+        return 1;
+    }
+    std::cout << std::endl << "✅ 스트리밍 결과가 일괄 처리와 같습니다 (마지막 행 포함)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,217 @@
+#pragma once
+#include "opencv2/opencv.hpp"
+#include <string>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+// 정답(ground truth)이 정확히 알려진 합성 테스트 영상 생성기
+// create_test_images.cpp (영상 세트 생성)와 parameter_sweep.cpp (정확도/속도 스윕)가 함께 사용
+
+namespace synthetic {
+
+    struct WorkloadSpec {
+        cv::Size size = cv::Size(640, 480);
+        int numLines = 8;               // 영상 전체를 가로지르는 직선 수 (절반은 rotation, 절반은 rotation + 90도)
+        int numCorners = 16;            // 코너 수 (회전된 사각형 하나당 4개)
+        double rotationDeg = 0.0;       // 직선과 사각형의 회전 각도
+        double noiseSigma = 0.0;        // 가우시안 노이즈 표준편차 (밝기 단위)
+        double edgeDensity = 0.0;       // 방해용 짧은 에지가 덮는 화소 비율 (0 ~ 1)
+        uint64 seed = 12345;
+    };
+
+    struct GroundTruth {
+        std::vector<cv::Vec2f> lines;       // (rho, theta), custom_cv::HoughLines와 같은 규약 (theta는 [0, pi))
+        std::vector<cv::Point2f> corners;   // 사각형 꼭짓점 (부화소 정확도)
+        std::vector<cv::Point2f> junctions; // 직선끼리, 직선과 사각형 변의 교차점 (코너처럼 응답하지만 recall 대상은 아님)
+    };
+
+    const int BACKGROUND = 60;
+    const int LINE_INTENSITY = 255;
+    const int RECT_INTENSITY = 190;
+    const int SHIFT_BITS = 4;               // fillConvexPoly 부화소 좌표 (1/16 화소)
+
+    // 정규형 직선 x*cos(theta) + y*sin(theta) = rho 에서 theta를 [0, pi)로 맞춤
+    inline cv::Vec2f normalizeLine(double rho, double theta) {
+        while (theta < 0) { theta += CV_PI; rho = -rho; }
+        while (theta >= CV_PI) { theta -= CV_PI; rho = -rho; }
+        return cv::Vec2f(static_cast<float>(rho), static_cast<float>(theta));
+    }
+
+    // 두 직선 (rho, theta)의 차이: theta 주기성 고려
+    inline void lineDistance(const cv::Vec2f& a, const cv::Vec2f& b, double& dRho, double& dTheta) {
+        double rhoB = b[0];
+        double thetaB = b[1];
+        double diff = a[1] - thetaB;
+        if (diff > CV_PI / 2) { thetaB += CV_PI; rhoB = -rhoB; }
+        else if (diff < -CV_PI / 2) { thetaB -= CV_PI; rhoB = -rhoB; }
+        dRho = std::abs(a[0] - rhoB);
+        dTheta = std::abs(a[1] - thetaB);
+    }
+
+    inline void drawFullLine(cv::Mat& img, const cv::Vec2f& line, int intensity) {
+        double c = std::cos(line[1]), s = std::sin(line[1]);
+        double x0 = line[0] * c, y0 = line[0] * s;
+        double L = std::hypot(img.cols, img.rows) + 10.0;
+        cv::Point p1(cvRound(x0 - L * s), cvRound(y0 + L * c));
+        cv::Point p2(cvRound(x0 + L * s), cvRound(y0 - L * c));
+        cv::line(img, p1, p2, cv::Scalar(intensity), 1, cv::LINE_8);
+    }
+
+    /**
+     * 합성 영상과 정답 생성
+     * 1) 회전된 격자 형태의 직선 (건물 구조와 유사) 2) 겹치지 않는 회전된 사각형
+     * 3) 방해용 짧은 에지 4) 가우시안 노이즈
+     */
+    inline void generate(const WorkloadSpec& spec, cv::Mat& image, GroundTruth& gt) {
+        cv::RNG rng(spec.seed);
+        image.create(spec.size, CV_8UC1);
+        image.setTo(cv::Scalar(BACKGROUND));
+        gt.lines.clear();
+        gt.corners.clear();
+        gt.junctions.clear();
+
+        const double w = spec.size.width, h = spec.size.height;
+        const double rot = spec.rotationDeg * CV_PI / 180.0;
+
+        // 1. 회전된 사각형 (서로 겹치지 않게 배치)
+        int numRects = (spec.numCorners + 3) / 4;
+        double minSide = 0.03 * std::min(w, h), maxSide = 0.08 * std::min(w, h);
+        std::vector<cv::Rect> occupied;
+        for (int i = 0, attempts = 0; i < numRects && attempts < numRects * 50; attempts++) {
+            cv::Point2f center(rng.uniform(0.1f, 0.9f) * static_cast<float>(w),
+                               rng.uniform(0.1f, 0.9f) * static_cast<float>(h));
+            cv::Size2f size(static_cast<float>(rng.uniform(minSide, maxSide)),
+                            static_cast<float>(rng.uniform(minSide, maxSide)));
+            cv::RotatedRect rect(center, size, static_cast<float>(spec.rotationDeg));
+            cv::Rect box = rect.boundingRect();
+            cv::Rect padded(box.x - box.width / 4, box.y - box.height / 4,
+                            box.width * 3 / 2, box.height * 3 / 2);
+
+            bool overlaps = false;
+            for (const auto& r : occupied) {
+                if ((r & padded).area() > 0) { overlaps = true; break; }
+            }
+            if (overlaps || (padded & cv::Rect(0, 0, spec.size.width, spec.size.height)) != padded) continue;
+
+            cv::Point2f v[4];
+            rect.points(v);
+            cv::Point fixed[4];
+            for (int j = 0; j < 4; j++) {
+                fixed[j] = cv::Point(cvRound(v[j].x * (1 << SHIFT_BITS)), cvRound(v[j].y * (1 << SHIFT_BITS)));
+                gt.corners.push_back(cv::Point2f(fixed[j].x / static_cast<float>(1 << SHIFT_BITS),
+                                                 fixed[j].y / static_cast<float>(1 << SHIFT_BITS)));
+            }
+            cv::fillConvexPoly(image, fixed, 4, cv::Scalar(RECT_INTENSITY), cv::LINE_8, SHIFT_BITS);
+            occupied.push_back(padded);
+            i++;
+        }
+
+        // 2. 직선: 방향 rot (법선 rot + 90도)과 rot + 90도 (법선 rot)
+        for (int i = 0; i < spec.numLines; i++) {
+            double theta = (i % 2 == 0) ? rot + CV_PI / 2 : rot;
+            double c = std::cos(theta), s = std::sin(theta);
+            // 영상 네 꼭짓점의 투영 범위 안쪽 10% ~ 90%에서 rho 선택
+            double p[4] = { 0.0, w * c, h * s, w * c + h * s };
+            double lo = *std::min_element(p, p + 4), hi = *std::max_element(p, p + 4);
+            int perGroup = (spec.numLines + 1 - i % 2) / 2;
+            int k = i / 2;
+            double t = 0.1 + 0.8 * (k + rng.uniform(0.25, 0.75)) / std::max(1, perGroup);
+            cv::Vec2f line = normalizeLine(lo + t * (hi - lo), theta);
+            drawFullLine(image, line, LINE_INTENSITY);
+            gt.lines.push_back(line);
+        }
+
+        for (size_t i = 0; i < gt.lines.size(); i++) {
+            for (size_t j = i + 1; j < gt.lines.size(); j++) {
+                double a1 = std::cos(gt.lines[i][1]), b1 = std::sin(gt.lines[i][1]);
+                double a2 = std::cos(gt.lines[j][1]), b2 = std::sin(gt.lines[j][1]);
+                double det = a1 * b2 - a2 * b1;
+                if (std::abs(det) < 1e-6) continue;
+                double x = (gt.lines[i][0] * b2 - gt.lines[j][0] * b1) / det;
+                double y = (a1 * gt.lines[j][0] - a2 * gt.lines[i][0]) / det;
+                if (x >= 0 && x < w && y >= 0 && y < h) {
+                    gt.junctions.push_back(cv::Point2f(static_cast<float>(x), static_cast<float>(y)));
+                }
+            }
+        }
+
+        // 직선이 사각형 변을 가로지르는 점 (사각형마다 꼭짓점 4개가 변 순서로 들어 있음)
+        for (const auto& line : gt.lines) {
+            double c = std::cos(line[1]), s = std::sin(line[1]);
+            for (size_t r = 0; r + 3 < gt.corners.size(); r += 4) {
+                for (int j = 0; j < 4; j++) {
+                    const cv::Point2f& a = gt.corners[r + j];
+                    const cv::Point2f& b = gt.corners[r + (j + 1) % 4];
+                    double da = a.x * c + a.y * s - line[0];
+                    double db = b.x * c + b.y * s - line[0];
+                    if ((da < 0) == (db < 0) || da == db) continue;
+                    double t = da / (da - db);
+                    gt.junctions.push_back(cv::Point2f(static_cast<float>(a.x + t * (b.x - a.x)),
+                                                       static_cast<float>(a.y + t * (b.y - a.y))));
+                }
+            }
+        }
+
+        // 3. 방해용 짧은 에지 (길이 4~12 화소)
+        int numClutter = static_cast<int>(spec.edgeDensity * w * h / 8.0);
+        for (int i = 0; i < numClutter; i++) {
+            cv::Point p1(rng.uniform(0, spec.size.width), rng.uniform(0, spec.size.height));
+            double a = rng.uniform(0.0, CV_PI);
+            double len = rng.uniform(4.0, 12.0);
+            cv::Point p2(cvRound(p1.x + len * std::cos(a)), cvRound(p1.y + len * std::sin(a)));
+            cv::line(image, p1, p2, cv::Scalar(rng.uniform(90, 170)), 1, cv::LINE_8);
+        }
+
+        // 4. 가우시안 노이즈
+        if (spec.noiseSigma > 0) {
+            cv::Mat noisy, noise(spec.size, CV_16S);
+            rng.fill(noise, cv::RNG::NORMAL, 0, spec.noiseSigma);
+            image.convertTo(noisy, CV_16S);
+            noisy += noise;
+            noisy.convertTo(image, CV_8U);
+        }
+    }
+
+    inline bool writeGroundTruth(const std::string& path, const WorkloadSpec& spec, const GroundTruth& gt) {
+        cv::FileStorage fs(path, cv::FileStorage::WRITE);
+        if (!fs.isOpened()) return false;
+
+        fs << "width" << spec.size.width << "height" << spec.size.height;
+        fs << "num_lines" << spec.numLines << "num_corners" << spec.numCorners;
+        fs << "rotation_deg" << spec.rotationDeg << "noise_sigma" << spec.noiseSigma;
+        fs << "edge_density" << spec.edgeDensity << "seed" << static_cast<double>(spec.seed);
+        fs << "lines" << cv::Mat(gt.lines).reshape(1);
+        fs << "corners" << cv::Mat(gt.corners).reshape(1);
+        fs << "junctions" << cv::Mat(gt.junctions).reshape(1);
+        return true;
+    }
+
+    inline bool readGroundTruth(const std::string& path, WorkloadSpec& spec, GroundTruth& gt) {
+        cv::FileStorage fs(path, cv::FileStorage::READ);
+        if (!fs.isOpened()) return false;
+
+        double seed = 0;
+        fs["width"] >> spec.size.width;
+        fs["height"] >> spec.size.height;
+        fs["num_lines"] >> spec.numLines;
+        fs["num_corners"] >> spec.numCorners;
+        fs["rotation_deg"] >> spec.rotationDeg;
+        fs["noise_sigma"] >> spec.noiseSigma;
+        fs["edge_density"] >> spec.edgeDensity;
+        fs["seed"] >> seed;
+        spec.seed = static_cast<uint64>(seed);
+
+        cv::Mat lines, corners, junctions;
+        fs["lines"] >> lines;
+        fs["corners"] >> corners;
+        fs["junctions"] >> junctions;
+        gt.lines.clear();
+        gt.corners.clear();
+        gt.junctions.clear();
+        for (int i = 0; i < lines.rows; i++) gt.lines.push_back(cv::Vec2f(lines.at<float>(i, 0), lines.at<float>(i, 1)));
+        for (int i = 0; i < corners.rows; i++) gt.corners.push_back(cv::Point2f(corners.at<float>(i, 0), corners.at<float>(i, 1)));
+        for (int i = 0; i < junctions.rows; i++) gt.junctions.push_back(cv::Point2f(junctions.at<float>(i, 0), junctions.at<float>(i, 1)));
+        return true;
+    }
+}
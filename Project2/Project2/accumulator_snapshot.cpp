@@ -0,0 +1,250 @@
+#include "accumulator_snapshot.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#ifdef _WIN32
+#define NOMINMAX // std::min 浹   windows.h include  ó
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+	const char SNAPSHOT_MAGIC[8] = { 'H', 'O', 'U', 'G', 'H', 'A', 'C', 'C' };
+	const uint64_t PAYLOAD_ALIGNMENT = 64;
+	const int32_t MAX_SNAPSHOT_SIZE = 1 << 20;  //     ( ũ  ġ ʵ)
+
+	// ȣ ִ ̸  ȣ  : 0, -1, 1, -2, 2 ... -> 0, 1, 2, 3, 4 ...
+	inline uint32_t ZigZag(int32_t value)
+	{
+		return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+	}
+
+	inline int32_t UnZigZag(uint32_t value)
+	{
+		return static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+	}
+
+	void AppendVarint(std::vector<uint8_t>& out, uint32_t value)
+	{
+		while (value >= 0x80) {
+			out.push_back(static_cast<uint8_t>(value | 0x80));
+			value >>= 7;
+		}
+		out.push_back(static_cast<uint8_t>(value));
+	}
+
+	// Ͱ ų 5Ʈ  false
+	inline bool ReadVarint(const uint8_t*& p, const uint8_t* end, uint32_t& value)
+	{
+		value = 0;
+		for (int shift = 0; shift < 35 && p < end; shift += 7) {
+			uint8_t byte = *p++;
+			value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0) return true;
+		}
+		return false;
+	}
+
+	// rho ึ theta  ̸  ( ù  0 )
+	void EncodeDelta(View2D<const int> accumulator, std::vector<uint8_t>& out)
+	{
+		out.clear();
+		out.reserve(static_cast<size_t>(accumulator.Width()) * accumulator.Height() + 64);
+		for (int r = 0; r < accumulator.Height(); ++r) {
+			const int* row = accumulator[r];
+			int previous = 0;
+			for (int t = 0; t < accumulator.Width(); ++t) {
+				AppendVarint(out, ZigZag(row[t] - previous));
+				previous = row[t];
+			}
+		}
+	}
+
+	bool DecodeDelta(const uint8_t* p, const uint8_t* end, Buffer2D<int>& accumulator)
+	{
+		for (int r = 0; r < accumulator.Height(); ++r) {
+			int* row = accumulator[r];
+			int previous = 0;
+			for (int t = 0; t < accumulator.Width(); ++t) {
+				uint32_t value;
+				if (!ReadVarint(p, end, value)) return false;
+				previous += UnZigZag(value);
+				row[t] = previous;
+			}
+		}
+		return p == end;
+	}
+}
+
+bool SaveAccumulatorSnapshot(const std::string& path, View2D<const int> accumulator,
+	double rhoMax, int imageWidth, int imageHeight, SnapshotEncoding encoding)
+{
+	SnapshotHeader header = {};
+	std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+	header.version = SNAPSHOT_VERSION;
+	header.encoding = static_cast<uint32_t>(encoding);
+	header.rhoSize = accumulator.Height();
+	header.thetaSize = accumulator.Width();
+	header.imageWidth = imageWidth;
+	header.imageHeight = imageHeight;
+	header.rhoMax = rhoMax;
+	header.payloadOffset = (sizeof(SnapshotHeader) + PAYLOAD_ALIGNMENT - 1) / PAYLOAD_ALIGNMENT * PAYLOAD_ALIGNMENT;
+
+	std::vector<uint8_t> packed;
+	if (encoding == SnapshotEncoding::Delta) {
+		EncodeDelta(accumulator, packed);
+		header.payloadBytes = packed.size();
+	}
+	else {
+		header.payloadBytes = static_cast<uint64_t>(accumulator.Width()) * accumulator.Height() * sizeof(int32_t);
+	}
+
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (!file) return false;
+
+	bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+	static const uint8_t padding[PAYLOAD_ALIGNMENT] = {};
+	size_t paddingBytes = static_cast<size_t>(header.payloadOffset - sizeof(header));
+	if (ok && paddingBytes > 0) ok = std::fwrite(padding, 1, paddingBytes, file) == paddingBytes;
+
+	if (encoding == SnapshotEncoding::Delta) {
+		if (ok && !packed.empty()) ok = std::fwrite(packed.data(), 1, packed.size(), file) == packed.size();
+	}
+	else {
+		// Buffer2D  е  
+		for (int r = 0; ok && r < accumulator.Height(); ++r) {
+			size_t count = static_cast<size_t>(accumulator.Width());
+			ok = std::fwrite(accumulator[r], sizeof(int32_t), count, file) == count;
+		}
+	}
+	ok = std::fclose(file) == 0 && ok;
+	return ok;
+}
+
+bool MappedFile::Open(const std::string& path)
+{
+	Close();
+#ifdef _WIN32
+	HANDLE fileHandleValue = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (fileHandleValue == INVALID_HANDLE_VALUE) return false;
+	fileHandle = fileHandleValue;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(fileHandleValue, &fileSize) || fileSize.QuadPart == 0) {
+		Close();
+		return false;
+	}
+	HANDLE mappingHandleValue = CreateFileMappingA(fileHandleValue, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mappingHandleValue == NULL) {
+		Close();
+		return false;
+	}
+	mappingHandle = mappingHandleValue;
+
+	void* view = MapViewOfFile(mappingHandleValue, FILE_MAP_READ, 0, 0, 0);
+	if (view == NULL) {
+		Close();
+		return false;
+	}
+	data = static_cast<const uint8_t*>(view);
+	size = static_cast<size_t>(fileSize.QuadPart);
+#else
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) return false;
+
+	struct stat info;
+	if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+		::close(fd);
+		return false;
+	}
+	void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd); //   ũ͸ ݾƵ 
+	if (view == MAP_FAILED) return false;
+	data = static_cast<const uint8_t*>(view);
+	size = static_cast<size_t>(info.st_size);
+#endif
+	return true;
+}
+
+void MappedFile::Close()
+{
+#ifdef _WIN32
+	if (data) UnmapViewOfFile(data);
+	if (mappingHandle) CloseHandle(mappingHandle);
+	if (fileHandle) CloseHandle(fileHandle);
+	mappingHandle = nullptr;
+	fileHandle = nullptr;
+#else
+	if (data) ::munmap(const_cast<uint8_t*>(data), size);
+#endif
+	data = nullptr;
+	size = 0;
+}
+
+bool AccumulatorSnapshot::Open(const std::string& path)
+{
+	accumulator = View2D<const int>();
+	if (!file.Open(path)) {
+		std::cerr << "    ϴ: " << path << std::endl;
+		return false;
+	}
+	if (file.Size() < sizeof(SnapshotHeader)) {
+		std::cerr << "  ʹ ۽ϴ: " << path << std::endl;
+		return false;
+	}
+	std::memcpy(&header, file.Data(), sizeof(header));
+
+	if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0 || header.version != SNAPSHOT_VERSION) {
+		std::cerr << "  ƴϰų  ʴ Դϴ: " << path << std::endl;
+		return false;
+	}
+	if (header.rhoSize <= 0 || header.thetaSize <= 0 ||
+		header.rhoSize > MAX_SNAPSHOT_SIZE || header.thetaSize > MAX_SNAPSHOT_SIZE ||
+		header.payloadOffset % PAYLOAD_ALIGNMENT != 0 ||
+		header.payloadOffset > file.Size() || header.payloadBytes > file.Size() - header.payloadOffset) {
+		std::cerr << "  ջǾϴ: " << path << std::endl;
+		return false;
+	}
+
+	const uint8_t* payload = file.Data() + header.payloadOffset;
+	if (header.encoding == static_cast<uint32_t>(SnapshotEncoding::Raw)) {
+		uint64_t expected = static_cast<uint64_t>(header.rhoSize) * header.thetaSize * sizeof(int32_t);
+		if (header.payloadBytes != expected) {
+			std::cerr << "  ũⰡ  ʽϴ: " << path << std::endl;
+			return false;
+		}
+		//   ּҴ  , payloadOffset 64 ̹Ƿ int  
+		accumulator = View2D<const int>(reinterpret_cast<const int*>(payload),
+			header.thetaSize, header.rhoSize, static_cast<size_t>(header.thetaSize));
+	}
+	else if (header.encoding == static_cast<uint32_t>(SnapshotEncoding::Delta)) {
+		//     ּ 1Ʈ̹Ƿ    Ʈ   ջ 
+		// (  ϰ Createϸ Ŵ ۸  bad_alloc )
+		uint64_t cells = static_cast<uint64_t>(header.rhoSize) * header.thetaSize;
+		uint64_t bufferBytes = (static_cast<uint64_t>(header.thetaSize) + Buffer2D<int>::ALIGNMENT / sizeof(int)) *
+			header.rhoSize * sizeof(int) + Buffer2D<int>::ALIGNMENT;
+		if (cells > header.payloadBytes || bufferBytes > SIZE_MAX) {
+			std::cerr << "  ũⰡ  ũ  ʽϴ: " << path << std::endl;
+			return false;
+		}
+		decoded.Create(header.thetaSize, header.rhoSize);
+		if (!DecodeDelta(payload, payload + header.payloadBytes, decoded)) {
+			std::cerr << " Ͱ ջǾϴ: " << path << std::endl;
+			return false;
+		}
+		accumulator = decoded;
+	}
+	else {
+		std::cerr << "    ڵԴϴ: " << path << std::endl;
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include "../../Common/buffer2d.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Hough    (.hacc)
+// ⸦    θ ǥ ٽ  ʰ lineThreshold, maxLines  ٲ㰡
+// GetLinesFromAccumulator ݺ    (main --sweep ).
+//
+//   (Ʋ ):
+//   SnapshotHeader (64Ʈ)
+//   payloadOffset ġ payloadBytes Ʈ 
+//     - Raw:   int32  , rho  켱 (rhoSize x thetaSize, е )
+//               ޸  ּҸ ״   ( )
+//     - Delta: rho ึ ̿ theta  ̸ zigzag +  (LEB128)  
+//              κ 0 Ǵ  ̶   1Ʈ,   ε Ͽ   Ǯ 
+
+enum class SnapshotEncoding : uint32_t {
+	Raw = 0,
+	Delta = 1
+};
+
+struct SnapshotHeader {
+	char magic[8];           // "HOUGHACC"
+	uint32_t version;        // SNAPSHOT_VERSION
+	uint32_t encoding;       // SnapshotEncoding
+	int32_t rhoSize;         //   
+	int32_t thetaSize;       //   
+	int32_t imageWidth;      //  ̹ ũ
+	int32_t imageHeight;
+	double rhoMax;           // PerformHoughTransform  rho ִ
+	uint64_t payloadOffset;  //  ۺ ͱ Ʈ  (64 )
+	uint64_t payloadBytes;   //  Ʈ 
+	uint64_t reserved;
+};
+
+static_assert(sizeof(SnapshotHeader) == 64, "SnapshotHeader must stay 64 bytes");
+
+const uint32_t SNAPSHOT_VERSION = 1;
+
+/**
+ * @brief ⸦  Ϸ մϴ.
+ * @param path   
+ * @param accumulator   (rhoSize  x thetaSize )
+ * @param rhoMax rho ִ
+ * @param imageWidth  ̹ ʺ
+ * @param imageHeight  ̹ 
+ * @param encoding Raw (  ٷ ) Ǵ Delta ( )
+ * @return  
+ */
+bool SaveAccumulatorSnapshot(const std::string& path, View2D<const int> accumulator,
+	double rhoMax, int imageWidth, int imageHeight, SnapshotEncoding encoding);
+
+/**
+ * @brief б  ޸   (Windows: MapViewOfFile,  : mmap).
+ */
+class MappedFile {
+public:
+	MappedFile() = default;
+	~MappedFile() { Close(); }
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool Open(const std::string& path);
+	void Close();
+
+	const uint8_t* Data() const { return data; }
+	size_t Size() const { return size; }
+
+private:
+	const uint8_t* data = nullptr;
+	size_t size = 0;
+#ifdef _WIN32
+	void* fileHandle = nullptr;
+	void* mappingHandle = nullptr;
+#endif
+};
+
+/**
+ * @brief   ޸      ְ մϴ.
+ *        Raw  ε ޸𸮸 ״ Ű, Delta      Ǯ Ӵϴ.
+ *        Accumulator()    ü  ִ ȸ ȿմϴ.
+ */
+class AccumulatorSnapshot {
+public:
+	/**
+	 * @brief   ϴ. ϸ  std::cerr մϴ.
+	 */
+	bool Open(const std::string& path);
+
+	View2D<const int> Accumulator() const { return accumulator; }
+	const SnapshotHeader& Header() const { return header; }
+	double RhoMax() const { return header.rhoMax; }
+
+private:
+	MappedFile file;
+	SnapshotHeader header = {};
+	Buffer2D<int> decoded;            // Delta  Ǭ 
+	View2D<const int> accumulator;    // ε Raw  Ǵ decoded
+};
@@ -2,18 +2,18 @@
 
 /**
  * @brief  迭 ִ (NMS) Ͽ ǹ ִ  մϴ.
- * @param accumulator Hough ȯ Ϸ  迭
+ * @param accumulator Hough ȯ Ϸ  迭 (bufInt Ǵ ε  )
  * @param threshold   ּ   (ǥ )
  * @param maxLines ȯ ִ  
  * @return   (Line)  
  */
 vecLine GetLinesFromAccumulator(
-	const vecVecInt& accumulator,
+	View2D<const int> accumulator,
 	int threshold, int maxLines)
 {
 	vecLine allCandidates; //   ĺ  
-	int rhoSize = (int)accumulator.size();         //   (rho )
-	int thetaSize = (int)accumulator[0].size();    //  ʺ (theta )
+	int rhoSize = accumulator.Height();       //   (rho )
+	int thetaSize = accumulator.Width();      //  ʺ (theta )
 	int rhoCenter = rhoSize / 2;              // rho ε   ߽
 
 	// 1. ִ (NMS)   ִ(local maxima) ã
@@ -51,8 +51,8 @@ vecLine GetLinesFromAccumulator(
 	}
 
 	// 2. (score)  ĺ  
-	//     Լ Ͽ   
-	std::sort(allCandidates.begin(), allCandidates.end(), [](const Line& a, const Line& b) {
+	//     Լ Ͽ    (  ĵ  )
+	std::stable_sort(allCandidates.begin(), allCandidates.end(), [](const Line& a, const Line& b) {
 		return a.score > b.score;
 	});
 
@@ -65,47 +65,228 @@ vecLine GetLinesFromAccumulator(
 	return finalLines;
 }
 
+// GetLinesFromAccumulatorTopK ĺ ( ġ )
+struct PeakCandidate {
+	int score;
+	int r_idx;
+	int t_idx;
+};
+
+//  ,  ĵ (r_idx, t_idx) ռ 켱 (GetLinesFromAccumulator    )
+static inline bool IsBetterPeak(const PeakCandidate& a, const PeakCandidate& b)
+{
+	if (a.score != b.score) return a.score > b.score;
+	if (a.r_idx != b.r_idx) return a.r_idx < b.r_idx;
+	return a.t_idx < b.t_idx;
+}
+
+/**
+ * @brief GetLinesFromAccumulator    ĺ   ʰ մϴ.
+ *        rho   ŭ   ÿ NMS ϰ,  ũ maxLines 
+ *        ݱ  ĺ մϴ.      Ӱ谪 Ǿ
+ *           3x3   ǳʶٹǷ, ĺ    ̹ ޸𸮿   maxLines մϴ.
+ *          ĺ  ٽ Ƿ  GetLinesFromAccumulator ϴ (  ĵ ).
+ * @param accumulator Hough ȯ Ϸ  迭 (bufInt Ǵ ε  )
+ * @param threshold   ּ   (ǥ )
+ * @param maxLines ȯ ִ  
+ * @param numThreads   (0̸ CPU ھ )
+ * @return   (Line)   ( )
+ */
+vecLine GetLinesFromAccumulatorTopK(
+	View2D<const int> accumulator,
+	int threshold, int maxLines, int numThreads)
+{
+	int rhoSize = accumulator.Height();
+	int thetaSize = accumulator.Width();
+	int rhoCenter = rhoSize / 2;
+	if (maxLines <= 0 || rhoSize < 3 || thetaSize < 3) return vecLine();
+
+	// 1. rho  NMS +  maxLines  (   =     ĺ)
+	int rows = rhoSize - 2;
+	std::vector<std::vector<PeakCandidate>> bandPeaks(ResolveThreadCount(numThreads, rows));
+	ParallelFor(1, rhoSize - 1, numThreads, [&](int rhoBegin, int rhoEnd, int band) {
+		std::vector<PeakCandidate>& heap = bandPeaks[band];
+		heap.reserve(maxLines);
+		int cutoff = threshold; //     ĺ   
+
+		for (int r_idx = rhoBegin; r_idx < rhoEnd; ++r_idx) {
+			const int* above = accumulator[r_idx - 1];
+			const int* row = accumulator[r_idx];
+			const int* below = accumulator[r_idx + 1];
+			for (int t_idx = 1; t_idx < thetaSize - 1; ++t_idx) {
+				int current_score = row[t_idx];
+				if (current_score <= cutoff) continue;
+
+				// ֺ 3x3  ϳ  ũ  ִ ƴ
+				if (above[t_idx - 1] > current_score || above[t_idx] > current_score || above[t_idx + 1] > current_score ||
+					row[t_idx - 1] > current_score || row[t_idx + 1] > current_score ||
+					below[t_idx - 1] > current_score || below[t_idx] > current_score || below[t_idx + 1] > current_score) {
+					continue;
+				}
+
+				// ĵ  ڿ Ƿ    ĺ  -> cutoff Ŀ߸ 
+				PeakCandidate peak = { current_score, r_idx, t_idx };
+				if ((int)heap.size() < maxLines) {
+					heap.push_back(peak);
+					std::push_heap(heap.begin(), heap.end(), IsBetterPeak);
+				}
+				else {
+					std::pop_heap(heap.begin(), heap.end(), IsBetterPeak);
+					heap.back() = peak;
+					std::push_heap(heap.begin(), heap.end(), IsBetterPeak);
+				}
+				if ((int)heap.size() == maxLines) {
+					cutoff = std::max(threshold, heap.front().score);
+				}
+			}
+		}
+	});
+
+	// 2.   ĺ  ü  maxLines 
+	std::vector<PeakCandidate> merged;
+	for (const auto& heap : bandPeaks) {
+		merged.insert(merged.end(), heap.begin(), heap.end());
+	}
+	size_t keep = std::min(merged.size(), static_cast<size_t>(maxLines));
+	std::partial_sort(merged.begin(), merged.begin() + keep, merged.end(), IsBetterPeak);
+
+	vecLine finalLines(keep);
+	for (size_t i = 0; i < keep; ++i) {
+		finalLines[i].rho = (double)(merged[i].r_idx - rhoCenter); // ε  rho  ȯ
+		finalLines[i].theta = (double)merged[i].t_idx * M_PI / thetaSize; // ε  theta () ȯ
+		finalLines[i].score = merged[i].score;
+	}
+	return finalLines;
+}
+
+#if HOUGH_USE_SSE2
+/**
+ * @brief BGR 48Ʈ(16ȼ) о B, G, R  иմϴ (SSE2 unpack ).
+ */
+static inline void LoadDeinterleaveBgr(const uint8_t* p, __m128i& b, __m128i& g, __m128i& r)
+{
+	__m128i t00 = _mm_loadu_si128((const __m128i*)p);
+	__m128i t01 = _mm_loadu_si128((const __m128i*)(p + 16));
+	__m128i t02 = _mm_loadu_si128((const __m128i*)(p + 32));
+
+	__m128i t10 = _mm_unpacklo_epi8(t00, _mm_unpackhi_epi64(t01, t01));
+	__m128i t11 = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t00, t00), t02);
+	__m128i t12 = _mm_unpacklo_epi8(t01, _mm_unpackhi_epi64(t02, t02));
+
+	__m128i t20 = _mm_unpacklo_epi8(t10, _mm_unpackhi_epi64(t11, t11));
+	__m128i t21 = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t10, t10), t12);
+	__m128i t22 = _mm_unpacklo_epi8(t11, _mm_unpackhi_epi64(t12, t12));
+
+	__m128i t30 = _mm_unpacklo_epi8(t20, _mm_unpackhi_epi64(t21, t21));
+	__m128i t31 = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t20, t20), t22);
+	__m128i t32 = _mm_unpacklo_epi8(t21, _mm_unpackhi_epi64(t22, t22));
+
+	b = _mm_unpacklo_epi8(t30, _mm_unpackhi_epi64(t31, t31));
+	g = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t30, t30), t32);
+	r = _mm_unpacklo_epi8(t31, _mm_unpackhi_epi64(t32, t32));
+}
+#endif
+
+/**
+ * @brief 16ȼ ũ(Ʈ i = x + i ȼ)  Ʈ ǥ Ͽ ߰մϴ.
+ */
+static inline void AppendEdgePoints(unsigned mask, int x, int y, vecEdgePoint& points)
+{
+	while (mask != 0) {
+#ifdef _MSC_VER
+		unsigned long bit;
+		_BitScanForward(&bit, mask);
+#else
+		unsigned bit = static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+		points.push_back({ x + static_cast<int>(bit), y });
+		mask &= mask - 1; //    Ʈ 
+	}
+}
+
 /**
- * @brief GDI+ Bitmap 2D     ȯմϴ.
- * @param bmp  ̹  Ʈ 
+ * @brief ̹   ȯմϴ.  ȯ Ӱ谪 񱳸   н óϰ,
+ *         Ʈ   ʰ  ȼ ǥ  ÿ ϴ.
+ *            (B+G+R)/3  ̹Ƿ     ϴ.
+ * @param image  ̹ (BGR8 Ǵ Gray8, imageio ڵ  )
  * @param threshold  Ǵ  Ӱ谪
- * @return  1,  0 ä 2D  
+ * @return   ( Ʈ = 1)  ǥ 
  */
-vecVecInt CreateEdgeMap(Bitmap* bmp, BYTE threshold)
+EdgeMap CreateEdgeMap(const imageio::Image& image, uint8_t threshold)
 {
-	UINT width = bmp->GetWidth();
-	UINT height = bmp->GetHeight();
-	vecVecInt edgeMap(height, vecInt(width, 0));
-
-	BitmapData bitmapData;
-	Rect rect(0, 0, width, height);
-	// LockBits: GetPixel/SetPixel ξ , ȼ Ϳ  ϴ 
-	bmp->LockBits(&rect, ImageLockModeRead, PixelFormat24bppRGB, &bitmapData);
-
-	BYTE* p = (BYTE*)bitmapData.Scan0; // ȼ   ּ
-	int stride = bitmapData.Stride;    //   ̹ Ͱ ϴ  Ʈ 
-
-	for (UINT y = 0; y < height; ++y) {
-		for (UINT x = 0; x < width; ++x) {
-			// 24bppRGB ̹Ƿ ȼ ϳ 3Ʈ(Blue, Green, Red) 
-			// ȼ ּ: p + y * stride + x * 3
-			//   ȯ: R, G, B   
-			BYTE gray = (p[y * stride + x * 3] + p[y * stride + x * 3 + 1] + p[y * stride + x * 3 + 2]) / 3;
-			//    Ӱ谪 ũ  
-			if (gray > threshold) {
-				edgeMap[y][x] = 1; //  ǥ
+	int width = image.width;
+	int height = image.height;
+	EdgeMap edgeMap;
+	edgeMap.width = width;
+	edgeMap.height = height;
+	edgeMap.bits.Create((width + 7) / 8, height);
+	edgeMap.bits.Fill(0);
+
+	// (B+G+R)/3 > threshold    B+G+R > 3*threshold+2  
+	const int sumThreshold = 3 * threshold + 2;
+
+	for (int y = 0; y < height; ++y) {
+		const uint8_t* p = image.Row(y); //   ȼ   ּ (е )
+		uint8_t* bitRow = edgeMap.bits[y];
+		int x = 0;
+
+#if HOUGH_USE_SSE2
+		// 16ȼ:   Ʈ ũ movemask 16Ʈ  ״ Ʈ  2Ʈ 
+		if (image.channels == 3) {
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i limit = _mm_set1_epi16(static_cast<short>(sumThreshold));
+			for (; x + 16 <= width; x += 16) {
+				__m128i b, g, r;
+				LoadDeinterleaveBgr(p + x * 3, b, g, r);
+				// 16Ʈ  ջ (ִ 765)
+				__m128i sumLo = _mm_add_epi16(_mm_add_epi16(_mm_unpacklo_epi8(b, zero), _mm_unpacklo_epi8(g, zero)), _mm_unpacklo_epi8(r, zero));
+				__m128i sumHi = _mm_add_epi16(_mm_add_epi16(_mm_unpackhi_epi8(b, zero), _mm_unpackhi_epi8(g, zero)), _mm_unpackhi_epi8(r, zero));
+				__m128i edge = _mm_packs_epi16(_mm_cmpgt_epi16(sumLo, limit), _mm_cmpgt_epi16(sumHi, limit));
+				unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(edge));
+				bitRow[x >> 3] = static_cast<uint8_t>(mask);
+				bitRow[(x >> 3) + 1] = static_cast<uint8_t>(mask >> 8);
+				AppendEdgePoints(mask, x, y, edgeMap.points);
+			}
+		}
+		else {
+			// ȣ  񱳸  0x80  ȣ ִ 񱳷 ó
+			const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+			const __m128i limit = _mm_set1_epi8(static_cast<char>(threshold ^ 0x80));
+			for (; x + 16 <= width; x += 16) {
+				__m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(p + x)), bias);
+				unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(v, limit)));
+				bitRow[x >> 3] = static_cast<uint8_t>(mask);
+				bitRow[(x >> 3) + 1] = static_cast<uint8_t>(mask >> 8);
+				AppendEdgePoints(mask, x, y, edgeMap.points);
+			}
+		}
+#endif
+
+		//  ȼ (SSE2   ü)
+		for (; x < width; ++x) {
+			bool isEdge;
+			if (image.channels == 3) {
+				// BGR8 ̹Ƿ ȼ ϳ 3Ʈ(Blue, Green, Red) 
+				isEdge = p[x * 3] + p[x * 3 + 1] + p[x * 3 + 2] > sumThreshold;
+			}
+			else {
+				// Gray8: ڵ  ̹    ȯ
+				isEdge = p[x] > threshold;
+			}
+			if (isEdge) {
+				bitRow[x >> 3] |= static_cast<uint8_t>(1 << (x & 7)); //  ǥ
+				edgeMap.points.push_back({ x, y });
 			}
 		}
 	}
 
-	bmp->UnlockBits(&bitmapData); // LockBits  ޸ 
 	return edgeMap;
 }
 
 /**
  * @brief    Hough ȯ Ͽ  迭 äϴ.
- * @param edgeMap    2D 
- * @param accumulator [] Hough ȯ   2D 
+ * @param edgeMap   ( ǥ ϸ ϹǷ    )
+ * @param accumulator [] Hough ȯ   2D  (rhoSize  x thetaSize )
  * @param width ̹ ʺ
  * @param height ̹ 
  * @param rhoMax []  rho ִ
@@ -113,15 +294,15 @@ vecVecInt CreateEdgeMap(Bitmap* bmp, BYTE threshold)
  * @param cosTable [] ̸  cos  ̺
  */
 void PerformHoughTransform(
-	const vecVecInt& edgeMap,
-	vecVecInt& accumulator,
+	const EdgeMap& edgeMap,
+	bufInt& accumulator,
 	int width, int height,
 	double& rhoMax, vecDouble& sinTable, vecDouble& cosTable)
 {
-	int thetaSize = (int)accumulator[0].size();
+	int thetaSize = accumulator.Width();
 	// rho ִ ̹ 밢 
 	rhoMax = sqrt(width * width + height * height);
-	int rhoSize = (int)accumulator.size();
+	int rhoSize = accumulator.Height();
 	int rhoCenter = rhoSize / 2;
 
 	// ȭ: ݺ ȿ sin/cos Լ  ȣϴ  ϱ  ̸ 
@@ -131,36 +312,206 @@ void PerformHoughTransform(
 		sinTable[t] = sin(theta);
 	}
 
-	// ̹  ȼ ȸ
-	for (int y = 0; y < height; ++y) {
-		for (int x = 0; x < width; ++x) {
-			//  ȼ( 1 ȼ) ؼ Hough ȯ 
-			if (edgeMap[y][x] != 0) {
-				//   (theta)  rho  
-				for (int t_idx = 0; t_idx < thetaSize; ++t_idx) {
-					// Hough ȯ ٽ :  = x*cos() + y*sin()
-					double rho = x * cosTable[t_idx] + y * sinTable[t_idx];
-					//  rho   迭 ε ȯ (+0.5 ݿø ȿ)
-					int r_idx = rhoCenter + static_cast<int>(rho + 0.5);
-					// ε  迭    쿡 ǥ( )
-					if (r_idx >= 0 && r_idx < rhoSize) {
-						accumulator[r_idx][t_idx]++;
-					}
-				}
+	//  ȼ ؼ Hough ȯ  (CreateEdgeMap  ǥ  ״ ȸ)
+	for (const EdgePoint& point : edgeMap.points) {
+		int x = point.x;
+		int y = point.y;
+		//   (theta)  rho  
+		for (int t_idx = 0; t_idx < thetaSize; ++t_idx) {
+			// Hough ȯ ٽ :  = x*cos() + y*sin()
+			double rho = x * cosTable[t_idx] + y * sinTable[t_idx];
+			//  rho   迭 ε ȯ (+0.5 ݿø ȿ)
+			int r_idx = rhoCenter + static_cast<int>(rho + 0.5);
+			// ε  迭    쿡 ǥ( )
+			if (r_idx >= 0 && r_idx < rhoSize) {
+				accumulator[r_idx][t_idx]++;
+			}
+		}
+	}
+}
+
+//  Hough ǥ Ҽ Ʈ  (Q16: 1.0 = 65536)
+const int HOUGH_FIXED_SHIFT = 16;
+// Q16  int32 ȿ  ִ (width + height): |x*cos + y*sin| * 65536 + 0.5 < 2^31
+const int HOUGH_FIXED_MAX_EXTENT = 32768;
+
+/**
+ * @brief double sin/cos ̺ (ȣڿ )   Q16  ̺ ϴ.
+ */
+static void BuildFixedTrigTables(int thetaSize, vecDouble& sinTable, vecDouble& cosTable,
+	vecInt& sinFixed, vecInt& cosFixed)
+{
+	const double one = (double)(1 << HOUGH_FIXED_SHIFT);
+	sinFixed.resize(thetaSize);
+	cosFixed.resize(thetaSize);
+	for (int t = 0; t < thetaSize; ++t) {
+		double theta = (double)t * M_PI / thetaSize;
+		cosTable[t] = cos(theta);
+		sinTable[t] = sin(theta);
+		cosFixed[t] = static_cast<int>(lround(cosTable[t] * one));
+		sinFixed[t] = static_cast<int>(lround(sinTable[t] * one));
+	}
+}
+
+/**
+ * @brief PerformHoughTransform  ⸦  길 äϴ.
+ *        sin/cos ̺ Q16  ٲٰ,    ȼ ̿
+ *        rho = x*cos + y*sin  theta  (rho += dx*cos) ϹǷ
+ *        ǥ double  double -> int ȯ ϴ.
+ *        ݿø   (rho + 0.5) 0  ϸ, ̺ ȭ  
+ *        迡 ɸ Ϻ ǥ   1 bin ̰   ֽϴ.
+ *        width + height 32768  Q16  int32   Ƿ PerformHoughTransform մϴ.
+ * @param edgeMap   ( ǥ   켱  )
+ * @param accumulator [] Hough ȯ   2D  (rhoSize  x thetaSize )
+ * @param width ̹ ʺ
+ * @param height ̹ 
+ * @param rhoMax []  rho ִ
+ * @param sinTable [] ̸  sin  ̺
+ * @param cosTable [] ̸  cos  ̺
+ */
+void PerformHoughTransformFixed(
+	const EdgeMap& edgeMap,
+	bufInt& accumulator,
+	int width, int height,
+	double& rhoMax, vecDouble& sinTable, vecDouble& cosTable)
+{
+	if (width + height > HOUGH_FIXED_MAX_EXTENT) {
+		PerformHoughTransform(edgeMap, accumulator, width, height, rhoMax, sinTable, cosTable);
+		return;
+	}
+
+	int thetaSize = accumulator.Width();
+	rhoMax = sqrt(width * width + height * height);
+	int rhoSize = accumulator.Height();
+	int rhoCenter = rhoSize / 2;
+
+	vecInt sinFixed, cosFixed;
+	BuildFixedTrigTables(thetaSize, sinTable, cosTable, sinFixed, cosFixed);
+	const int half = 1 << (HOUGH_FIXED_SHIFT - 1);
+
+	// theta   ȼ (rho + 0.5) Q16 
+	vecInt rhoFixed(thetaSize);
+	vecInt binIndex(thetaSize);
+	int* rho = rhoFixed.data();
+	int* bin = binIndex.data();
+	const int* cosQ = cosFixed.data();
+	const int* sinQ = sinFixed.data();
+	const int roundMask = (1 << HOUGH_FIXED_SHIFT) - 1;
+	int currentY = -1;
+	int currentX = 0;
+
+	int* acc = accumulator.Data();
+	const int stride = static_cast<int>(accumulator.Stride());
+
+	for (const EdgePoint& point : edgeMap.points) {
+		if (point.y != currentY) {
+			//  : x = 0 ġ  (y*sin + 0.5) 
+			currentY = point.y;
+			currentX = 0;
+			for (int t = 0; t < thetaSize; ++t) {
+				rho[t] = currentY * sinQ[t] + half;
+			}
+		}
+		//  ࿡ x dxŭ þ rho dx*cosŭ þ ( ̹Ƿ   )
+		const int dx = point.x - currentX;
+		currentX = point.x;
+
+		// 1)  theta rho ε б   (Ϸ SIMD ȭ  ִ )
+		for (int t_idx = 0; t_idx < thetaSize; ++t_idx) {
+			int value = rho[t_idx] + dx * cosQ[t_idx];
+			rho[t_idx] = value;
+			// static_cast<int>(rho + 0.5)  0  :  Ʈ  (1 - 2^-16)  ø
+			bin[t_idx] = rhoCenter + ((value + ((value >> 31) & roundMask)) >> HOUGH_FIXED_SHIFT);
+		}
+		// 2) ǥ (0 <= r_idx < rhoSize ˻縦 ȣ     ó)
+		for (int t_idx = 0; t_idx < thetaSize; ++t_idx) {
+			int r_idx = bin[t_idx];
+			if (static_cast<unsigned>(r_idx) < static_cast<unsigned>(rhoSize)) {
+				acc[r_idx * stride + t_idx]++;
 			}
 		}
 	}
 }
 
 /**
- * @brief    Ʈ  ׸ϴ.
- * @param bmp  ̹  Ʈ 
+ * @brief PerformHoughTransformFixed theta    忡 մϴ.
+ *          ڱ theta  ⸸ Ƿ  ̳  ܰ谡 ,
+ *            ǥ  б⸸ մϴ.
+ *        ǥ theta rho   ġ (thetaSize  x rhoSize ) ϹǷ
+ *         theta ǥ   ȿ ̰,  rho 켱 ġ(GetLinesFromAccumulator ϴ ) ǵϴ.
+ *         ̹Ƿ     PerformHoughTransformFixed Ȯ ϴ.
+ * @param edgeMap  
+ * @param accumulator [] Hough ȯ   2D  (rhoSize  x thetaSize )
+ * @param width ̹ ʺ
+ * @param height ̹ 
+ * @param rhoMax []  rho ִ
+ * @param sinTable [] ̸  sin  ̺
+ * @param cosTable [] ̸  cos  ̺
+ * @param numThreads   (0̸ CPU ھ )
+ */
+void PerformHoughTransformParallel(
+	const EdgeMap& edgeMap,
+	bufInt& accumulator,
+	int width, int height,
+	double& rhoMax, vecDouble& sinTable, vecDouble& cosTable,
+	int numThreads)
+{
+	if (width + height > HOUGH_FIXED_MAX_EXTENT) {
+		PerformHoughTransform(edgeMap, accumulator, width, height, rhoMax, sinTable, cosTable);
+		return;
+	}
+
+	int thetaSize = accumulator.Width();
+	rhoMax = sqrt(width * width + height * height);
+	int rhoSize = accumulator.Height();
+	int rhoCenter = rhoSize / 2;
+
+	vecInt sinFixed, cosFixed;
+	BuildFixedTrigTables(thetaSize, sinTable, cosTable, sinFixed, cosFixed);
+	const int half = 1 << (HOUGH_FIXED_SHIFT - 1);
+	const int roundMask = (1 << HOUGH_FIXED_SHIFT) - 1;
+
+	// ġ :  = theta,  = rho (  64Ʈ 迡 ϹǷ  ̿ ĳ   )
+	bufInt votes(rhoSize, thetaSize, 0);
+	const EdgePoint* points = edgeMap.points.data();
+	const int pointCount = static_cast<int>(edgeMap.points.size());
+
+	// 1. theta  ǥ
+	ParallelFor(0, thetaSize, numThreads, [&](int thetaBegin, int thetaEnd, int) {
+		for (int t_idx = thetaBegin; t_idx < thetaEnd; ++t_idx) {
+			const int cosQ = cosFixed[t_idx];
+			const int sinQ = sinFixed[t_idx];
+			int* row = votes[t_idx];
+			for (int i = 0; i < pointCount; ++i) {
+				// PerformHoughTransformFixed     (x*cos + y*sin + 0.5, Q16)
+				int value = points[i].x * cosQ + points[i].y * sinQ + half;
+				int r_idx = rhoCenter + ((value + ((value >> 31) & roundMask)) >> HOUGH_FIXED_SHIFT);
+				if (static_cast<unsigned>(r_idx) < static_cast<unsigned>(rhoSize)) {
+					row[r_idx]++;
+				}
+			}
+		}
+	});
+
+	// 2. rho  ġ ⸦ rho 켱 ġ ǵ (  帶 ġ )
+	ParallelFor(0, rhoSize, numThreads, [&](int rhoBegin, int rhoEnd, int) {
+		for (int r_idx = rhoBegin; r_idx < rhoEnd; ++r_idx) {
+			int* dst = accumulator[r_idx];
+			for (int t_idx = 0; t_idx < thetaSize; ++t_idx) {
+				dst[t_idx] += votes[t_idx][r_idx];
+			}
+		}
+	});
+}
+
+/**
+ * @brief    ̹  ׸ϴ.
+ * @param image  ̹
  * @param lines ׸    
  */
-void DrawLines(Bitmap* bmp, const vecLine& lines)
+void DrawLines(imageio::Image& image, const vecLine& lines)
 {
-	Graphics graphics(bmp); // GDI+ ׸ ۾  ü
-	Pen pen(Color(255, 255, 0, 0), 3); // β 3   
+	const imageio::Color red = { 0, 0, 255 }; // β 3  
 
 	for (const auto& line : lines) {
 		//  Ķ(rho, theta) ̿Ͽ     
@@ -178,131 +529,194 @@ void DrawLines(Bitmap* bmp, const vecLine& lines)
 		int x2 = static_cast<int>(x0 - 2000 * (-b));
 		int y2 = static_cast<int>(y0 - 2000 * (a));
 
-		graphics.DrawLine(&pen, x1, y1, x2, y2);
+		imageio::DrawLine(image, x1, y1, x2, y2, red, 3);
 	}
 }
 
 /**
- * @brief GDI+ ̹ ϱ  ʿ ڴ CLSID  ǥ Լ.
- * @param format ã ϴ ̹  (: L"image/png")
- * @param pClsid [] ã ڴ CLSID  
- * @return   0 ̻ ,   -1
- */
-int GetEncoderClsid(const WCHAR* format, CLSID* pClsid)
-{
-	UINT  num = 0;
-	UINT  size = 0;
-
-	ImageCodecInfo* pImageCodecInfo = NULL;
-	GetImageEncodersSize(&num, &size);
-	if (size == 0) return -1;
-
-	pImageCodecInfo = (ImageCodecInfo*)(malloc(size));
-	if (pImageCodecInfo == NULL) return -1;
-
-	GetImageEncoders(num, size, pImageCodecInfo);
-
-	for (UINT j = 0; j < num; ++j) {
-		if (wcscmp(pImageCodecInfo[j].MimeType, format) == 0) {
-			*pClsid = pImageCodecInfo[j].Clsid;
-			free(pImageCodecInfo);
-			return j;
-		}
-	}
-
-	free(pImageCodecInfo);
-	return -1;
-}
-
-/**
- * @brief  (2D ) ð Ȯ ϵ  ̹ Ϸ մϴ.
+ * @brief  (Ʈ ) ð Ȯ ϵ  ̹ Ϸ մϴ.
  * @param edgeMap    
- * @param width ̹ ʺ
- * @param height ̹ 
  * @param filename   
  */
-void SaveEdgeMap(const vecVecInt& edgeMap, UINT width, UINT height, const WCHAR* filename)
+void SaveEdgeMap(const EdgeMap& edgeMap, const std::string& filename)
 {
-	Bitmap edgeBmp(width, height, PixelFormat24bppRGB);
-
-	BitmapData bitmapData;
-	Rect rect(0, 0, width, height);
-	edgeBmp.LockBits(&rect, ImageLockModeWrite, PixelFormat24bppRGB, &bitmapData);
-
-	BYTE* p = (BYTE*)bitmapData.Scan0;
-	int stride = bitmapData.Stride;
-	const BYTE white = 255;
-	const BYTE black = 0;
-
-	for (UINT y = 0; y < height; ++y) {
-		BYTE* row = p + y * stride;
-		for (UINT x = 0; x < width; ++x) {
-			// edgeMap  1̸ , 0̸  ȼ ä
-			BYTE color = (edgeMap[y][x] == 1) ? white : black;
-			row[x * 3] = color;
-			row[x * 3 + 1] = color;
-			row[x * 3 + 2] = color;
+	int width = edgeMap.width;
+	int height = edgeMap.height;
+	imageio::Image edgeImage;
+	edgeImage.Create(width, height, imageio::PixelFormat::Gray8);
+
+	const uint8_t white = 255;
+	const uint8_t black = 0;
+
+	for (int y = 0; y < height; ++y) {
+		uint8_t* row = edgeImage.Row(y);
+		for (int x = 0; x < width; ++x) {
+			// edgeMap Ʈ 1̸ , 0̸  ȼ ä
+			row[x] = edgeMap.IsEdge(x, y) ? white : black;
 		}
 	}
 
-	edgeBmp.UnlockBits(&bitmapData);
-
-	CLSID pngClsid;
-	GetEncoderClsid(L"image/png", &pngClsid);
-	if (edgeBmp.Save(filename, &pngClsid, NULL) == Ok) {
-		std::wcout << L"Edge map saved to: " << filename << std::endl;
+	imageio::Status status = imageio::Save(filename, edgeImage);
+	if (status == imageio::Status::Ok) {
+		std::cout << "Edge map saved to: " << filename << std::endl;
 	}
 	else {
-		std::wcerr << L"Failed to save edge map." << std::endl;
+		std::cerr << "Failed to save edge map: " << imageio::StatusMessage(status) << std::endl;
 	}
 }
 
-//  α׷  Լ
-int main()
+/**
+ * @brief ̹  忡   , Hough ȯ,  , ׸,  մϴ.
+ * @param decoder ̹ ڴ (  ó    )
+ * @param image  ̹  (  ó  )
+ * @param inputPath Է ̹ 
+ * @param edgeMapPath    
+ * @param resultPath  ׸  ̹  
+ * @param snapshotPath     ( ڿ̸  )
+ * @param snapshotEncoding  
+ * @return  
+ */
+bool ProcessImage(imageio::Decoder& decoder, imageio::Image& image, const std::string& inputPath,
+	const std::string& edgeMapPath, const std::string& resultPath,
+	const std::string& snapshotPath, SnapshotEncoding snapshotEncoding)
 {
-	// GdiplusInitializer ü   GDI+ ۵ǰ,
-	// main Լ   ü ҸǸ鼭 ڵ GDI+ .
-	GdiplusInitializer gdiplusInitializer;
-
-	// 1. ̹ ε
-	Bitmap* originalBmp = new Bitmap(L"./images/line_01.png");
-	if (originalBmp->GetLastStatus() != Ok) {
-		std::cerr << "̹    ϴ." << std::endl;
-		return -1;
+	// 1. ̹ ε ( ÷ ׸  BGR ڵ)
+	imageio::Status status = decoder.Decode(inputPath, image, imageio::PixelFormat::BGR8);
+	if (status != imageio::Status::Ok) {
+		std::cerr << "̹    ϴ: " << inputPath << " (" << imageio::StatusMessage(status) << ")" << std::endl;
+		return false;
 	}
-	UINT width = originalBmp->GetWidth();
-	UINT height = originalBmp->GetHeight();
+	int width = image.width;
+	int height = image.height;
 
 	// 2.   (̹ ó)
-	vecVecInt edgeMap = CreateEdgeMap(originalBmp, 128);
+	EdgeMap edgeMap = CreateEdgeMap(image, 128);
 	// ߰    Ϸ Ͽ Ȯ
-	SaveEdgeMap(edgeMap, width, height, L"./images/result_edge_map.png");
+	SaveEdgeMap(edgeMap, edgeMapPath);
 
 	// 3. Hough ȯ 
 	int thetaSize = 180; // theta 0~179 1  ˻
 	double rhoMax = sqrt(width * width + height * height);
 	int rhoSize = static_cast<int>(2 * rhoMax); // rho -rhoMax ~ +rhoMax 
-	//  迭 0 ʱȭ
-	vecVecInt accumulator(rhoSize, vecInt(thetaSize, 0));
+	//  迭 0 ʱȭ (   Ҵ,  = rho,  = theta)
+	bufInt accumulator(thetaSize, rhoSize, 0);
 	vecDouble sinTable(thetaSize); // sin, cos ̺
 	vecDouble cosTable(thetaSize);
-	PerformHoughTransform(edgeMap, accumulator, width, height, rhoMax, sinTable, cosTable);
+	PerformHoughTransformParallel(edgeMap, accumulator, width, height, rhoMax, sinTable, cosTable, 0);
+
+	//    (--sweep 忡 ǥ    Ķ͸ ٲ㺼  )
+	if (!snapshotPath.empty()) {
+		if (SaveAccumulatorSnapshot(snapshotPath, accumulator, rhoMax, width, height, snapshotEncoding)) {
+			std::cout << "Accumulator snapshot saved to: " << snapshotPath << std::endl;
+		}
+		else {
+			std::cerr << "Failed to save accumulator snapshot: " << snapshotPath << std::endl;
+		}
+	}
 
 	// 4.    ͸
 	int lineThreshold = 100; //  Ǵ ּ ǥ 
 	int maxLinesToDraw = 10; //      10 
-	vecLine allDetectedLines = GetLinesFromAccumulator(accumulator, lineThreshold, maxLinesToDraw);
+	vecLine allDetectedLines = GetLinesFromAccumulatorTopK(accumulator, lineThreshold, maxLinesToDraw, 0);
 	std::cout << "Total detected lines (before filtering): " << allDetectedLines.size() << std::endl;
 
 	// 5.   ׸
-	DrawLines(originalBmp, allDetectedLines);
+	DrawLines(image, allDetectedLines);
 
 	// 6.   ̹ 
-	CLSID pngClsid;
-	GetEncoderClsid(L"image/png", &pngClsid);
-	originalBmp->Save(L"./images/result_lines.png", &pngClsid, NULL);
+	status = imageio::Save(resultPath, image);
+	if (status != imageio::Status::Ok) {
+		std::cerr << " ̹   ϴ: " << resultPath << " (" << imageio::StatusMessage(status) << ")" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @brief    lineThreshold, maxLines  ٲ㰡  ⸸ ݺմϴ.
+ *        ̹ ε,  , ǥ ٽ  Ƿ   յ ݹ ϴ.
+ * @param snapshotPath    (--snapshot   )
+ * @return  
+ */
+bool RunParameterSweep(const std::string& snapshotPath)
+{
+	AccumulatorSnapshot snapshot;
+	if (!snapshot.Open(snapshotPath)) return false;
+	View2D<const int> accumulator = snapshot.Accumulator();
+	const SnapshotHeader& header = snapshot.Header();
+
+	std::cout << "Snapshot: " << snapshotPath << " (image " << header.imageWidth << "x" << header.imageHeight
+		<< ", accumulator " << header.rhoSize << "x" << header.thetaSize
+		<< (header.encoding == static_cast<uint32_t>(SnapshotEncoding::Raw) ? ", raw/mapped" : ", delta") << ")" << std::endl;
+	std::cout << "threshold\tmaxLines\tlines\ttopScore\tlowestScore" << std::endl;
+
+	const int maxLinesOptions[] = { 5, 10, 20, 50 };
+	int runs = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int lineThreshold = 50; lineThreshold <= 500; lineThreshold += 10) {
+		for (int maxLines : maxLinesOptions) {
+			vecLine lines = GetLinesFromAccumulatorTopK(accumulator, lineThreshold, maxLines, 0);
+			++runs;
+			std::cout << lineThreshold << "\t" << maxLines << "\t" << lines.size() << "\t"
+				<< (lines.empty() ? 0 : lines.front().score) << "\t"
+				<< (lines.empty() ? 0 : lines.back().score) << std::endl;
+		}
+	}
+	double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	std::cout << runs << " settings in " << elapsedMs << " ms" << std::endl;
+	return true;
+}
 
-	//  Ҵ Ʈ ü 
-	delete originalBmp;
-	return 0;
+//  α׷  Լ
+// : Project2                  -> ./images/line_01.png ó
+//         Project2 a.png b.jpg ...  -> ̹ ≮>_edge_map.png, ≮>_lines.png  (ġ ó)
+//         Project2 --snapshot a.png ...         ->   ≮>_accumulator.hacc (Raw)  
+//         Project2 --snapshot-packed a.png ...  ->  Delta ( ) 
+//         Project2 --sweep a_accumulator.hacc   ->    Ķ   (ǥ )
+int main(int argc, char** argv)
+{
+	if (argc == 3 && std::string(argv[1]) == "--sweep") {
+		return RunParameterSweep(argv[2]) ? 0 : -1;
+	}
+
+	// Session ü   ̹ 鿣(GDI+ ) ۵ǰ,
+	// main Լ   ü ҸǸ鼭 ڵ .
+	imageio::Session imageIoSession;
+
+	// ڴ ̹ ۴  Է¿ 
+	imageio::Decoder decoder;
+	imageio::Image image;
+
+	int firstInput = 1;
+	bool saveSnapshot = false;
+	SnapshotEncoding snapshotEncoding = SnapshotEncoding::Raw;
+	if (argc > 1 && (std::string(argv[1]) == "--snapshot" || std::string(argv[1]) == "--snapshot-packed")) {
+		saveSnapshot = true;
+		snapshotEncoding = std::string(argv[1]) == "--snapshot" ? SnapshotEncoding::Raw : SnapshotEncoding::Delta;
+		firstInput = 2;
+	}
+
+	if (argc <= firstInput) {
+		bool ok = ProcessImage(decoder, image, "./images/line_01.png",
+			"./images/result_edge_map.png", "./images/result_lines.png",
+			saveSnapshot ? "./images/result_accumulator.hacc" : "", snapshotEncoding);
+		return ok ? 0 : -1;
+	}
+
+	int failures = 0;
+	for (int i = firstInput; i < argc; ++i) {
+		std::string inputPath = argv[i];
+		// Ȯڸ   (͸ ̸  )
+		size_t dot = inputPath.find_last_of('.');
+		size_t slash = inputPath.find_last_of("/\\");
+		std::string stem = (dot != std::string::npos && (slash == std::string::npos || dot > slash))
+			? inputPath.substr(0, dot) : inputPath;
+
+		std::cout << "[" << i - firstInput + 1 << "/" << argc - firstInput << "] " << inputPath << std::endl;
+		if (!ProcessImage(decoder, image, inputPath, stem + "_edge_map.png", stem + "_lines.png",
+			saveSnapshot ? stem + "_accumulator.hacc" : "", snapshotEncoding)) {
+			++failures;
+		}
+	}
+	return failures == 0 ? 0 : -1;
 }
\ No newline at end of file
@@ -1,17 +1,28 @@
 #pragma once
-#define NOMINMAX // std::min 浹   windows.h include  ó
-#include <windows.h>
-#include <gdiplus.h>
+#include "../../Common/image_io.h"
+#include "../../Common/buffer2d.h"
+#include "../../Common/parallel_for.h"
+#include "accumulator_snapshot.h"
+#include <chrono>
 #include <iostream>
+#include <string>
 #include <vector>
 #include <cmath>
 #include <algorithm>
 
-// GDI+ ӽ̽ 
-using namespace Gdiplus;
-#pragma comment (lib,"Gdiplus.lib")
+// SSE2 x64 ׻   (32Ʈ  /arch:SSE2 ̻ )
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HOUGH_USE_SSE2 1
+#include <emmintrin.h>
+#else
+#define HOUGH_USE_SSE2 0
+#endif
 
-const double M_PI = 3.14159265358979323846;
+// ̹  Common/image_io (Windows: GDI+, Linux: libpng/libjpeg)
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
 
 //    ϱ  ü
 struct Line {
@@ -20,22 +31,24 @@ struct Line {
 	int score;    //   (󸶳     ǥߴ)
 };
 
+//  ȼ ǥ
+struct EdgePoint {
+	int x, y;
+};
+
 //  ϴ Ÿ 
 typedef std::vector<Line>				vecLine;
+typedef std::vector<EdgePoint>			vecEdgePoint;
 typedef std::vector<int>				vecInt;
 typedef std::vector<double>				vecDouble;
-typedef std::vector<std::vector<int>>	vecVecInt;
-
-// GDI+   Ḧ   Ŭ
-class GdiplusInitializer {
-public:
-	GdiplusInitializer() {
-		GdiplusStartupInput gdiplusStartupInput;
-		GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, NULL);
-	}
-	~GdiplusInitializer() {
-		GdiplusShutdown(gdiplusToken);
-	}
-private:
-	ULONG_PTR gdiplusToken;
+typedef Buffer2D<int>					bufInt;    //  2D  (  Ҵ , [y][x]  )
+
+//   : Ʈ    ʰ  ȼ ǥ 
+struct EdgeMap {
+	int width = 0;
+	int height = 0;
+	Buffer2D<uint8_t> bits;  // ȼ 1Ʈ: x° ȼ bits[y][x / 8] (x % 8)° Ʈ
+	vecEdgePoint points;     //  ȼ ǥ ( 켱 ), Hough ȯ  ϸ ȸ
+
+	bool IsEdge(int x, int y) const { return (bits[y][x >> 3] >> (x & 7)) & 1; }
 };
\ No newline at end of file
@@ -2,15 +2,15 @@
 
 /**
  * @brief Harris  ʿ ִ (NMS) Ӱ谪 Ͽ  ڳ մϴ.
- * @param harrisResponse  ȼ ڳ (R)   2D 
+ * @param harrisResponse  ȼ ڳ (R)   2D 
  * @param threshold ڳʷ Ǵ Ӱ谪 (ִ    , : 0.01  1%)
  * @return  ڳ(Corner) 
  */
-vecCorner GetCorners(const vecVecDouble& harrisResponse, double threshold)
+vecCorner GetCorners(const bufDouble& harrisResponse, double threshold)
 {
 	vecCorner corners;
-	int height = (int)harrisResponse.size();
-	int width = (int)harrisResponse[0].size();
+	int height = harrisResponse.Height();
+	int width = harrisResponse.Width();
 
 	// 1. R  ִ ã Ӱ谪 밪 ȯմϴ.
 	//    ̷ ϸ ̹  ⳪   ϰ  մϴ.
@@ -53,64 +53,112 @@ vecCorner GetCorners(const vecVecDouble& harrisResponse, double threshold)
 }
 
 /**
- * @brief  ڳʵ  Ʈ  ð ǥմϴ.
- * @param bmp  ̹  Ʈ 
+ * @brief GetCorners  ڳʸ     о ķ ãϴ.
+ *         (band)  ϳ  ִ񰪰, 3x3  ִ ڳ ĺ(  ) Բ ϴ.
+ *        ü ִ  ִ񰪵 ִ̹Ƿ,     maxResponse * threshold ĺ ٽ Ÿϴ.
+ *          ġǷ   GetCorners ϴ ( 켱).
+ * @param harrisResponse  ȼ ڳ (R)   2D 
+ * @param threshold ڳʷ Ǵ Ӱ谪 (ִ    , : 0.01  1%)
+ * @param numThreads   (0̸ CPU ھ )
+ * @return  ڳ(Corner) 
+ */
+vecCorner GetCornersParallel(const bufDouble& harrisResponse, double threshold, int numThreads)
+{
+	vecCorner corners;
+	int height = harrisResponse.Height();
+	int width = harrisResponse.Width();
+	if (height < 3 || width < 3) return corners;
+
+	int rows = height - 2;
+	int bands = ResolveThreadCount(numThreads, rows);
+	std::vector<vecCorner> bandCandidates(bands);
+	vecDouble bandMax(bands, 0.0);
+
+	ParallelFor(1, height - 1, numThreads, [&](int yBegin, int yEnd, int band) {
+		vecCorner& candidates = bandCandidates[band];
+		double localMax = 0;
+		for (int y = yBegin; y < yEnd; ++y) {
+			const double* above = harrisResponse[y - 1];
+			const double* center = harrisResponse[y];
+			const double* below = harrisResponse[y + 1];
+			for (int x = 1; x < width - 1; ++x) {
+				double r = center[x];
+				if (r > localMax) localMax = r;
+				// ü ִ >= ݱ  ִ̹Ƿ, ⼭  ȼ  Ӱ谪  
+				// (threshold ̸  谡 Ƿ ̸ Ÿ )
+				if (threshold >= 0 && r <= localMax * threshold) continue;
+				// ִ (NMS): ֺ 3x3   ū   ڳʰ ƴ
+				if (above[x - 1] > r || above[x] > r || above[x + 1] > r ||
+					center[x - 1] > r || center[x + 1] > r ||
+					below[x - 1] > r || below[x] > r || below[x + 1] > r) continue;
+				candidates.push_back({ x, y, r });
+			}
+		}
+		bandMax[band] = localMax;
+	});
+
+	// ü ִ   ĺ  Ӱ谪 Ÿ
+	double maxResponse = *std::max_element(bandMax.begin(), bandMax.end());
+	double actualThreshold = maxResponse * threshold;
+	for (const vecCorner& candidates : bandCandidates) {
+		for (const Corner& candidate : candidates) {
+			if (candidate.response > actualThreshold) corners.push_back(candidate);
+		}
+	}
+	return corners;
+}
+
+/**
+ * @brief  ڳʵ  ̹  ð ǥմϴ.
+ * @param image  ̹
  * @param corners ׸ ڳʵ   
  */
-void DrawCorners(Bitmap* bmp, const vecCorner& corners)
+void DrawCorners(imageio::Image& image, const vecCorner& corners)
 {
-	Graphics graphics(bmp); // GDI+ ׸ ü 
-	SolidBrush brush(Color(255, 255, 0, 0)); // ä  귯 
+	const imageio::Color red = { 0, 0, 255 }; // ä 
 
 	for (const auto& corner : corners) {
-		//  ڳ (x, y) ġ  (Ÿ) ׷ ǥ
-		graphics.FillEllipse(&brush, corner.x - 6, corner.y - 6, 12, 12);
+		//  ڳ (x, y) ġ  12   ׷ ǥ
+		imageio::FillCircle(image, corner.x, corner.y, 6, red);
 	}
 }
 
 /**
- * @brief GDI+ Bitmap 2D  ̹(double Ÿ ) ȯմϴ.
- * @param bmp  ̹  Ʈ 
- * @return 0.0 ~ 255.0     2D double 
+ * @brief ÷(BGR) ̹ 2D  ̹(double Ÿ ) ȯմϴ.
+ *         Ҽ ؾ ϹǷ ڴ   ȯ  ⼭  մϴ.
+ * @param image  ̹ (BGR8)
+ * @return 0.0 ~ 255.0     2D double 
  */
-vecVecDouble ConvertToGrayscale(Bitmap* bmp)
+bufDouble ConvertToGrayscale(const imageio::Image& image)
 {
-	UINT width = bmp->GetWidth();
-	UINT height = bmp->GetHeight();
-	vecVecDouble grayImage(height, vecDouble(width));
+	int width = image.width;
+	int height = image.height;
+	bufDouble grayImage(width, height);
 
-	BitmapData bitmapData;
-	Rect rect(0, 0, width, height);
-	// LockBits: ȼ Ϳ  Ͽ ó ӵ ̴ GDI+ ǥ 
-	bmp->LockBits(&rect, ImageLockModeRead, PixelFormat24bppRGB, &bitmapData);
-
-	BYTE* p = (BYTE*)bitmapData.Scan0; // ȼ   ޸ ּ
-	int stride = bitmapData.Stride;    // ̹  (row)  ޸ ũ (byte)
-
-	for (UINT y = 0; y < height; ++y) {
-		for (UINT x = 0; x < width; ++x) {
-			// ȼ ּ: ּ + y * stride + x * 3 (ȼ 3Ʈ)
+	for (int y = 0; y < height; ++y) {
+		const uint8_t* p = image.Row(y); //  (row)  ּ (е )
+		double* grayRow = grayImage[y];
+		for (int x = 0; x < width; ++x) {
+			// ȼ ּ:  ּ + x * 3 (ȼ 3Ʈ)
 			// R, G, B    ϰ   ȯ
-			grayImage[y][x] = (double)(p[y * stride + x * 3] + p[y * stride + x * 3 + 1] + p[y * stride + x * 3 + 2]) / 3.0;
+			grayRow[x] = (double)(p[x * 3] + p[x * 3 + 1] + p[x * 3 + 2]) / 3.0;
 		}
 	}
-
-	bmp->UnlockBits(&bitmapData); // ޸  
 	return grayImage;
 }
 
 /**
  * @brief Sobel ڸ ̿Ͽ ̹ x, y  ׷Ʈ( ȭ) մϴ.
  * @param grayImage  ̹ 
- * @param gradX [] x ׷Ʈ  2D 
- * @param gradY [] y ׷Ʈ  2D 
+ * @param gradX [] x ׷Ʈ  2D 
+ * @param gradY [] y ׷Ʈ  2D 
  */
-void ComputeGradients(const vecVecDouble& grayImage,
-	vecVecDouble& gradX,
-	vecVecDouble& gradY)
+void ComputeGradients(const bufDouble& grayImage,
+	bufDouble& gradX,
+	bufDouble& gradY)
 {
-	int height = (int)grayImage.size();
-	int width = (int)grayImage[0].size();
+	int height = grayImage.Height();
+	int width = grayImage.Width();
 
 	// Sobel Ŀ(ũ): ̹ ̺() ٻϴ  Ǵ 
 	double sobelX[3][3] = { {-1, 0, 1}, {-2, 0, 2}, {-1, 0, 1} }; // x(μ)  
@@ -133,32 +181,137 @@ void ComputeGradients(const vecVecDouble& grayImage,
 	}
 }
 
+namespace {
+	/**
+	 * @brief double   float ٲ յڿ 1ȼ ڸ   Ӵϴ ( width + 2).
+	 */
+	void LoadPaddedRow(const double* src, int width, float* dst)
+	{
+		for (int x = 0; x < width; ++x) dst[x + 1] = (float)src[x];
+		dst[0] = dst[1];
+		dst[width + 1] = dst[width];
+	}
+}
+
+/**
+ * @brief ComputeGradients  Sobel ׷Ʈ и  · մϴ.
+ *        Sobel X = [1 2 1]^T x [-1 0 1], Sobel Y = [-1 0 1]^T x [1 2 1] ̹Ƿ
+ *          [1 2 1] հ [-1 0 1] ̸   ۿ  ,      մϴ.
+ *        (ȼ - 18 ->   8)
+ *         float SSE2  4ȼ ϰ,      óմϴ.
+ *        ڸ ̹    ȼ  ä (replicate) 1ȼ ׵θ մϴ.
+ * @param grayImage  ̹ 
+ * @param gradX [] x ׷Ʈ  2D  (grayImage  ũ,  ȼ )
+ * @param gradY [] y ׷Ʈ  2D  (grayImage  ũ,  ȼ )
+ * @param numThreads   (0̸ CPU ھ )
+ */
+void ComputeGradientsSeparable(const bufDouble& grayImage,
+	bufDouble& gradX,
+	bufDouble& gradY,
+	int numThreads)
+{
+	int height = grayImage.Height();
+	int width = grayImage.Width();
+	int paddedWidth = width + 2;
+
+	ParallelFor(0, height, numThreads, [&](int yBegin, int yEnd, int) {
+		//   3     (y°  y % 3 )
+		Buffer2D<float> rows(paddedWidth, 3);
+		int loadedRow[3] = { -1, -1, -1 };
+		//   : 0 = [1 2 1] , 1 = [-1 0 1] 
+		Buffer2D<float> vertical(paddedWidth, 2);
+		float* smooth = vertical[0];
+		float* diff = vertical[1];
+
+		auto getRow = [&](int srcY) -> const float* {
+			int slot = srcY % 3;
+			if (loadedRow[slot] != srcY) {
+				LoadPaddedRow(grayImage[srcY], width, rows[slot]);
+				loadedRow[slot] = srcY;
+			}
+			return rows[slot];
+		};
+
+		for (int y = yBegin; y < yEnd; ++y) {
+			const float* above = getRow(std::max(y - 1, 0));
+			const float* center = getRow(y);
+			const float* below = getRow(std::min(y + 1, height - 1));
+
+			// 1.  : smooth = above + 2*center + below, diff = below - above
+			int i = 0;
+#if HARRIS_USE_SSE2
+			for (; i + 4 <= paddedWidth; i += 4) {
+				__m128 a = _mm_loadu_ps(above + i);
+				__m128 c = _mm_loadu_ps(center + i);
+				__m128 b = _mm_loadu_ps(below + i);
+				_mm_storeu_ps(smooth + i, _mm_add_ps(_mm_add_ps(a, b), _mm_add_ps(c, c)));
+				_mm_storeu_ps(diff + i, _mm_sub_ps(b, a));
+			}
+#endif
+			for (; i < paddedWidth; ++i) {
+				smooth[i] = above[i] + 2.0f * center[i] + below[i];
+				diff[i] = below[i] - above[i];
+			}
+
+			// 2.   (е   x  ε x + 1)
+			//    gx = smooth[x+1] - smooth[x-1], gy = diff[x-1] + 2*diff[x] + diff[x+1]
+			double* gx = gradX[y];
+			double* gy = gradY[y];
+			int x = 0;
+#if HARRIS_USE_SSE2
+			for (; x + 4 <= width; x += 4) {
+				__m128 left = _mm_loadu_ps(smooth + x);
+				__m128 right = _mm_loadu_ps(smooth + x + 2);
+				__m128 dl = _mm_loadu_ps(diff + x);
+				__m128 dc = _mm_loadu_ps(diff + x + 1);
+				__m128 dr = _mm_loadu_ps(diff + x + 2);
+				__m128 sx = _mm_sub_ps(right, left);
+				__m128 sy = _mm_add_ps(_mm_add_ps(dl, dr), _mm_add_ps(dc, dc));
+				_mm_storeu_pd(gx + x, _mm_cvtps_pd(sx));
+				_mm_storeu_pd(gx + x + 2, _mm_cvtps_pd(_mm_movehl_ps(sx, sx)));
+				_mm_storeu_pd(gy + x, _mm_cvtps_pd(sy));
+				_mm_storeu_pd(gy + x + 2, _mm_cvtps_pd(_mm_movehl_ps(sy, sy)));
+			}
+#endif
+			for (; x < width; ++x) {
+				gx[x] = smooth[x + 2] - smooth[x];
+				gy[x] = diff[x] + 2.0f * diff[x + 1] + diff[x + 2];
+			}
+		}
+	});
+}
+
 /**
  * @brief  ׷Ʈ ̿Ͽ Harris ڳ (R score) մϴ.
  * @param gradX x ׷Ʈ 
  * @param gradY y ׷Ʈ 
  * @param windowSize ڳ    ֺ ȼ   ũ ( 3 Ǵ 5)
  * @param k Harris ڳ    ( 0.04 ~ 0.06)
- * @return  ȼ ڳ (R)   2D 
+ * @return  ȼ ڳ (R)   2D 
  */
-vecVecDouble ComputeHarrisResponse(
-	const vecVecDouble& gradX,
-	const vecVecDouble& gradY,
+bufDouble ComputeHarrisResponse(
+	const bufDouble& gradX,
+	const bufDouble& gradY,
 	int windowSize, double k)
 {
-	int height = (int)gradX.size();
-	int width = (int)gradX[0].size();
-	vecVecDouble harrisResponse(height, vecDouble(width, 0.0));
+	int height = gradX.Height();
+	int width = gradX.Width();
+	bufDouble harrisResponse(width, height, 0.0);
 
 	// ȭ  Ix*Ix, Iy*Iy, Ix*Iy  ̸ Ͽ 
-	vecVecDouble Ixx(height, vecDouble(width));
-	vecVecDouble Iyy(height, vecDouble(width));
-	vecVecDouble Ixy(height, vecDouble(width));
+	bufDouble Ixx(width, height);
+	bufDouble Iyy(width, height);
+	bufDouble Ixy(width, height);
 	for (int y = 0; y < height; ++y) {
+		const double* gx = gradX[y];
+		const double* gy = gradY[y];
+		double* xx = Ixx[y];
+		double* yy = Iyy[y];
+		double* xy = Ixy[y];
 		for (int x = 0; x < width; ++x) {
-			Ixx[y][x] = gradX[y][x] * gradX[y][x];
-			Iyy[y][x] = gradY[y][x] * gradY[y][x];
-			Ixy[y][x] = gradX[y][x] * gradY[y][x];
+			xx[x] = gx[x] * gx[x];
+			yy[x] = gy[x] * gy[x];
+			xy[x] = gx[x] * gy[x];
 		}
 	}
 
@@ -189,42 +342,110 @@ vecVecDouble ComputeHarrisResponse(
 
 
 /**
- * @brief GDI+ ̹ ϱ  ʿ ڴ CLSID  ǥ Լ.
+ * @brief ComputeHarrisResponse    ũ  ȼ   մϴ.
+ *           running sum  running sum  (и   ),
+ *        Ix*Ix, Iy*Iy, Ix*Iy  ึ  ڸ ϹǷ  ũ Ixx/Iyy/Ixy ۸  ʽϴ.
+ *          ֱ windowSize ุ  ۷ մϴ.
+ *         ϰ   ޶ ComputeHarrisResponse εҼ ݿø  ̸ ֽϴ.
+ * @param gradX x ׷Ʈ 
+ * @param gradY y ׷Ʈ 
+ * @param windowSize ڳ    ֺ ȼ   ũ (ũ⿡  ӵ ޶ )
+ * @param k Harris ڳ    ( 0.04 ~ 0.06)
+ * @return  ȼ ڳ (R)   2D  (찡   ʴ ڸ 0)
  */
-int GetEncoderClsid(const WCHAR* format, CLSID* pClsid)
+bufDouble ComputeHarrisResponseRunningSum(
+	const bufDouble& gradX,
+	const bufDouble& gradY,
+	int windowSize, double k)
 {
-	UINT  num = 0;
-	UINT  size = 0;
+	int height = gradX.Height();
+	int width = gradX.Width();
+	bufDouble harrisResponse(width, height, 0.0);
 
-	ImageCodecInfo* pImageCodecInfo = NULL;
-	GetImageEncodersSize(&num, &size);
-	if (size == 0) return -1;
+	int offset = windowSize / 2;
+	int span = 2 * offset + 1; //     
+	if (width < span || height < span) return harrisResponse;
 
-	pImageCodecInfo = (ImageCodecInfo*)(malloc(size));
-	if (pImageCodecInfo == NULL) return -1;
+	//   
+	vecDouble productXX(width), productYY(width), productXY(width);
+	// ึ    ( : y°  y % span )
+	bufDouble rowSumXX(width, span), rowSumYY(width, span), rowSumXY(width, span);
+	//  ֱ span      =  
+	vecDouble Sxx(width, 0.0), Syy(width, 0.0), Sxy(width, 0.0);
 
-	GetImageEncoders(num, size, pImageCodecInfo);
+	for (int y = 0; y < height; ++y) {
+		// 1.   Ix*Ix, Iy*Iy, Ix*Iy
+		const double* gx = gradX[y];
+		const double* gy = gradY[y];
+		for (int x = 0; x < width; ++x) {
+			productXX[x] = gx[x] * gx[x];
+			productYY[x] = gy[x] * gy[x];
+			productXY[x] = gx[x] * gy[x];
+		}
 
-	for (UINT j = 0; j < num; ++j) {
-		if (wcscmp(pImageCodecInfo[j].MimeType, format) == 0) {
-			*pClsid = pImageCodecInfo[j].Clsid;
-			free(pImageCodecInfo);
-			return j;
+		// 2.   Կ ִ span      츦 Ƿ  
+		int slot = y % span;
+		double* hxx = rowSumXX[slot];
+		double* hyy = rowSumYY[slot];
+		double* hxy = rowSumXY[slot];
+		if (y >= span) {
+			for (int x = offset; x < width - offset; ++x) {
+				Sxx[x] -= hxx[x];
+				Syy[x] -= hyy[x];
+				Sxy[x] -= hxy[x];
+			}
+		}
+
+		// 3.  running sum:   ĭ     ϰ   
+		double sxx = 0, syy = 0, sxy = 0;
+		for (int x = 0; x < span; ++x) {
+			sxx += productXX[x];
+			syy += productYY[x];
+			sxy += productXY[x];
+		}
+		hxx[offset] = sxx;
+		hyy[offset] = syy;
+		hxy[offset] = sxy;
+		for (int x = offset + 1; x < width - offset; ++x) {
+			sxx += productXX[x + offset] - productXX[x - offset - 1];
+			syy += productYY[x + offset] - productYY[x - offset - 1];
+			sxy += productXY[x + offset] - productXY[x - offset - 1];
+			hxx[x] = sxx;
+			hyy[x] = syy;
+			hxy[x] = sxy;
+		}
+
+		// 4.  running sum   
+		for (int x = offset; x < width - offset; ++x) {
+			Sxx[x] += hxx[x];
+			Syy[x] += hyy[x];
+			Sxy[x] += hxy[x];
 		}
-	}
 
-	free(pImageCodecInfo);
-	return -1;
+		// 5. 찡 span      (y - offset)  
+		if (y >= span - 1) {
+			double* response = harrisResponse[y - offset];
+			for (int x = offset; x < width - offset; ++x) {
+				// M = [ Sxx Sxy ]
+				//     [ Sxy Syy ]
+				double det = Sxx[x] * Syy[x] - Sxy[x] * Sxy[x];
+				double trace = Sxx[x] + Syy[x];
+				// R = det(M) - k * (trace(M))^2
+				response[x] = det - k * trace * trace;
+			}
+		}
+	}
+	return harrisResponse;
 }
 
 /**
  * @brief Harris ڳ   0-255  ȭϿ  ̹ Ϸ մϴ.
  */
-void SaveHarrisResponseMap(const vecVecDouble& harrisResponse, const WCHAR* filename)
+void SaveHarrisResponseMap(const bufDouble& harrisResponse, const std::string& filename)
 {
-	int height = (int)harrisResponse.size();
+	int height = harrisResponse.Height();
 	if (height == 0) return;
-	int width = (int)harrisResponse[0].size();
+	int width = harrisResponse.Width();
 	if (width == 0) return;
 
 	// 1. ðȭ  R  0~255  ȯϴ ȭ 
@@ -237,87 +458,119 @@ void SaveHarrisResponseMap(const vecVecDouble& harrisResponse, const WCHAR* file
 		}
 	}
 
-	Bitmap responseBmp(width, height, PixelFormat24bppRGB);
-	BitmapData bitmapData;
-	Rect rect(0, 0, width, height);
-	responseBmp.LockBits(&rect, ImageLockModeWrite, PixelFormat24bppRGB, &bitmapData);
+	imageio::Image responseImage;
+	responseImage.Create(width, height, imageio::PixelFormat::Gray8);
 
-	BYTE* p = (BYTE*)bitmapData.Scan0;
-	int stride = bitmapData.Stride;
 	double range = maxR - minR;
 	if (range == 0) range = 1.0; // 0   
 
 	// 2.  ȼ R  0~255     ȯ
 	for (int y = 0; y < height; ++y) {
-		BYTE* row = p + y * stride;
+		uint8_t* row = responseImage.Row(y);
 		for (int x = 0; x < width; ++x) {
 			// ȭ : newValue = ( (currentValue - min) / (max - min) ) * 255
 			double normalizedValue = (harrisResponse[y][x] - minR) / range;
-			BYTE color = static_cast<BYTE>(normalizedValue * 255.0);
-			row[x * 3] = color;
-			row[x * 3 + 1] = color;
-			row[x * 3 + 2] = color;
+			row[x] = static_cast<uint8_t>(normalizedValue * 255.0);
 		}
 	}
-	responseBmp.UnlockBits(&bitmapData);
 
 	// 3. ȭ  ̹ Ϸ 
-	CLSID pngClsid;
-	GetEncoderClsid(L"image/png", &pngClsid);
-	if (responseBmp.Save(filename, &pngClsid, NULL) == Ok) {
-		std::wcout << L"Harris response map saved to: " << filename << std::endl;
+	imageio::Status status = imageio::Save(filename, responseImage);
+	if (status == imageio::Status::Ok) {
+		std::cout << "Harris response map saved to: " << filename << std::endl;
 	}
 	else {
-		std::wcerr << L"Failed to save Harris response map." << std::endl;
+		std::cerr << "Failed to save Harris response map: " << imageio::StatusMessage(status) << std::endl;
 	}
 }
 
-// α׷ 
-int main()
+/**
+ * @brief ̹  忡   ȯ, ׷Ʈ, Harris , ڳ , ׸,  մϴ.
+ * @param decoder ̹ ڴ (  ó    )
+ * @param image  ̹  (  ó  )
+ * @param inputPath Է ̹ 
+ * @param responseMapPath Harris    
+ * @param resultPath ڳʸ ׸  ̹  
+ * @return  
+ */
+bool ProcessImage(imageio::Decoder& decoder, imageio::Image& image, const std::string& inputPath,
+	const std::string& responseMapPath, const std::string& resultPath)
 {
-	// main Լ ۵  GDI+ ʱȭϰ,   ڵ 
-	GdiplusInitializer gdiplusInitializer;
-
-	// --- 1. ̹ ε ---
-	Bitmap* originalBmp = new Bitmap(L"./images/shapes_01.png");
-	if (originalBmp->GetLastStatus() != Ok) {
-		std::cerr << "̹    ϴ." << std::endl;
-		return -1;
+	// --- 1. ̹ ε (ڳʸ ÷ ׸  BGR ڵ) ---
+	imageio::Status status = decoder.Decode(inputPath, image, imageio::PixelFormat::BGR8);
+	if (status != imageio::Status::Ok) {
+		std::cerr << "̹    ϴ: " << inputPath << " (" << imageio::StatusMessage(status) << ")" << std::endl;
+		return false;
 	}
-	UINT width = originalBmp->GetWidth();
-	UINT height = originalBmp->GetHeight();
+	int width = image.width;
+	int height = image.height;
 
 	// --- 2.  ȯ (ó) ---
-	vecVecDouble grayImage = ConvertToGrayscale(originalBmp);
+	bufDouble grayImage = ConvertToGrayscale(image);
 
 	// --- 3. ׷Ʈ  ---
-	vecVecDouble gradX(height, vecDouble(width, 0));
-	vecVecDouble gradY(height, vecDouble(width, 0));
-	ComputeGradients(grayImage, gradX, gradY);
+	bufDouble gradX(width, height);
+	bufDouble gradY(width, height);
+	ComputeGradientsSeparable(grayImage, gradX, gradY, 0);
 
 	// --- 4. Harris ڳ   ---
 	int windowSize = 3;
 	double k = 0.04;
-	vecVecDouble harrisResponse = ComputeHarrisResponse(gradX, gradY, windowSize, k);
+	bufDouble harrisResponse = ComputeHarrisResponseRunningSum(gradX, gradY, windowSize, k);
 
 	// ߰  Harris Response Map ̹ Ϸ 
-	SaveHarrisResponseMap(harrisResponse, L"./images/result_harris_response.png");
+	SaveHarrisResponseMap(harrisResponse, responseMapPath);
 
 	// --- 5.  ڳ ã ---
 	double cornerThreshold = 0.05; // Ӱ谪 5% Ͽ  Ȯ ڳʸ 
-	vecCorner detectedCorners = GetCorners(harrisResponse, cornerThreshold);
+	vecCorner detectedCorners = GetCornersParallel(harrisResponse, cornerThreshold, 0);
 
 	std::cout << "Detected " << detectedCorners.size() << " corners." << std::endl;
 
 	// --- 6.  ׸ ---
-	DrawCorners(originalBmp, detectedCorners);
+	DrawCorners(image, detectedCorners);
 
 	// --- 7.   ---
-	CLSID pngClsid;
-	GetEncoderClsid(L"image/png", &pngClsid);
-	originalBmp->Save(L"./images/result_corners.png", &pngClsid, NULL);
-
-	// Ҵ ޸ 
-	delete originalBmp;
-	return 0;
+	status = imageio::Save(resultPath, image);
+	if (status != imageio::Status::Ok) {
+		std::cerr << " ̹   ϴ: " << resultPath << " (" << imageio::StatusMessage(status) << ")" << std::endl;
+		return false;
+	}
+	return true;
 }
+
+// α׷ 
+// : Project3                  -> ./images/shapes_01.png ó
+//         Project3 a.png b.jpg ...  -> ̹ ≮>_harris_response.png, ≮>_corners.png  (ġ ó)
+int main(int argc, char** argv)
+{
+	// Session ü   ̹ 鿣(GDI+ ) ۵ǰ,
+	// main Լ   ü ҸǸ鼭 ڵ .
+	imageio::Session imageIoSession;
+
+	// ڴ ̹ ۴  Է¿ 
+	imageio::Decoder decoder;
+	imageio::Image image;
+
+	if (argc < 2) {
+		bool ok = ProcessImage(decoder, image, "./images/shapes_01.png",
+			"./images/result_harris_response.png", "./images/result_corners.png");
+		return ok ? 0 : -1;
+	}
+
+	int failures = 0;
+	for (int i = 1; i < argc; ++i) {
+		std::string inputPath = argv[i];
+		// Ȯڸ   (͸ ̸  )
+		size_t dot = inputPath.find_last_of('.');
+		size_t slash = inputPath.find_last_of("/\\");
+		std::string stem = (dot != std::string::npos && (slash == std::string::npos || dot > slash))
+			? inputPath.substr(0, dot) : inputPath;
+
+		std::cout << "[" << i << "/" << argc - 1 << "] " << inputPath << std::endl;
+		if (!ProcessImage(decoder, image, inputPath, stem + "_harris_response.png", stem + "_corners.png")) {
+			++failures;
+		}
+	}
+	return failures == 0 ? 0 : -1;
+}
\ No newline at end of file
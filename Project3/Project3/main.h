@@ -1,17 +1,26 @@
 #pragma once
-#define NOMINMAX // std::min 浹   windows.h include  ó
-#include <windows.h>
-#include <gdiplus.h>
+#include "../../Common/image_io.h"
+#include "../../Common/buffer2d.h"
+#include "../../Common/parallel_for.h"
 #include <iostream>
+#include <string>
 #include <vector>
 #include <cmath>
 #include <algorithm>
 
-// GDI+ ӽ̽ 
-using namespace Gdiplus;
-#pragma comment (lib,"Gdiplus.lib")
+// SSE2 x64 ׻   (32Ʈ  /arch:SSE2 ̻ )
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HARRIS_USE_SSE2 1
+#include <emmintrin.h>
+#else
+#define HARRIS_USE_SSE2 0
+#endif
 
-const double M_PI = 3.14159265358979323846;
+// ̹  Common/image_io (Windows: GDI+, Linux: libpng/libjpeg)
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
 
 //  ڳ  ϱ  ü
 struct Corner {
@@ -22,18 +31,4 @@ struct Corner {
 //  ϴ Ÿ 
 typedef std::vector<Corner>				 vecCorner;
 typedef std::vector<double>				 vecDouble;
-typedef std::vector<std::vector<double>> vecVecDouble;
-
-// GDI+   Ḧ   Ŭ
-class GdiplusInitializer {
-public:
-	GdiplusInitializer() {
-		GdiplusStartupInput gdiplusStartupInput;
-		GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, NULL);
-	}
-	~GdiplusInitializer() {
-		GdiplusShutdown(gdiplusToken);
-	}
-private:
-	ULONG_PTR gdiplusToken;
-};
\ No newline at end of file
+typedef Buffer2D<double>				 bufDouble;    //  2D  (  Ҵ , [y][x]  )
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "face_matcher.h"
+#include "../Project1/Project1/custom_cv_arena.h"
 #include <algorithm>
 #include <cmath>
 
@@ -137,6 +138,9 @@ void FaceMatcher::runFaceMatching() {
     bool paused = false;
     
     while (true) {
+        // 프레임 단위 임시 버퍼 (검출/매칭 중간 결과)는 프레임 아레나에서 할당, 반복이 끝나면 한 번에 반환
+        custom_cv::FrameArena::Scope frameScope;
+        
         if (!paused || !isVideoFile) {
             videoCapture >> frame;
             if (frame.empty()) {
@@ -241,7 +245,7 @@ std::vector<cv::Rect> FaceMatcher::detectFaces(const cv::Mat& frame) {
         return faces;
     }
     
-    cv::Mat grayFrame;
+    cv::Mat grayFrame = custom_cv::FrameArena::mat();
     try {
         if (frame.channels() == 3) {
             cv::cvtColor(frame, grayFrame, cv::COLOR_BGR2GRAY);
@@ -282,12 +286,12 @@ double FaceMatcher::matchFace(const cv::Mat& face1, const cv::Mat& face2) {
 
 double FaceMatcher::calculateTemplateMatchScore(const cv::Mat& face1, const cv::Mat& face2) {
     // 동일한 크기로 조정
-    cv::Mat resized1, resized2;
+    cv::Mat resized1 = custom_cv::FrameArena::mat(), resized2 = custom_cv::FrameArena::mat();
     cv::resize(face1, resized1, cv::Size(100, 100));
     cv::resize(face2, resized2, cv::Size(100, 100));
     
     // 그레이스케일 변환
-    cv::Mat gray1, gray2;
+    cv::Mat gray1 = custom_cv::FrameArena::mat(), gray2 = custom_cv::FrameArena::mat();
     if (resized1.channels() == 3) cv::cvtColor(resized1, gray1, cv::COLOR_BGR2GRAY);
     else gray1 = resized1.clone();
     
@@ -295,7 +299,7 @@ double FaceMatcher::calculateTemplateMatchScore(const cv::Mat& face1, const cv::
     else gray2 = resized2.clone();
     
     // 템플릿 매칭
-    cv::Mat result;
+    cv::Mat result = custom_cv::FrameArena::mat();
     cv::matchTemplate(gray1, gray2, result, cv::TM_CCOEFF_NORMED);
     
     double minVal, maxVal;
@@ -307,7 +311,7 @@ double FaceMatcher::calculateTemplateMatchScore(const cv::Mat& face1, const cv::
 
 double FaceMatcher::calculateHistogramSimilarity(const cv::Mat& face1, const cv::Mat& face2) {
     // HSV 변환
-    cv::Mat hsv1, hsv2;
+    cv::Mat hsv1 = custom_cv::FrameArena::mat(), hsv2 = custom_cv::FrameArena::mat();
     cv::cvtColor(face1, hsv1, cv::COLOR_BGR2HSV);
     cv::cvtColor(face2, hsv2, cv::COLOR_BGR2HSV);
     
@@ -318,7 +322,7 @@ double FaceMatcher::calculateHistogramSimilarity(const cv::Mat& face1, const cv:
     const float* ranges[] = {hRanges, sRanges};
     int channels[] = {0, 1};
     
-    cv::Mat hist1, hist2;
+    cv::Mat hist1 = custom_cv::FrameArena::mat(), hist2 = custom_cv::FrameArena::mat();
     cv::calcHist(&hsv1, 1, channels, cv::Mat(), hist1, 2, histSize, ranges);
     cv::calcHist(&hsv2, 1, channels, cv::Mat(), hist2, 2, histSize, ranges);
     